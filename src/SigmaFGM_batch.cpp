@@ -0,0 +1,289 @@
+
+/**
+ * \file      SigmaFGM_batch.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Run a batch of replicate simulations in a single process
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "../cmake/Config.h"
+
+#include <iostream>
+#include <sstream>
+#include <cstring>
+#include <thread>
+#include <csignal>
+#include <assert.h>
+
+#include "./lib/Macros.h"
+#include "./lib/Enums.h"
+#include "./lib/Parameters.h"
+#include "./lib/Simulation.h"
+#include "./lib/ThreadPool.h"
+
+void readArgs( int argc, char const** argv, Parameters* parameters, int& replicates, int& threads );
+void printUsage( void );
+void printHeader( void );
+void stopHandler( int signal_number );
+void runReplicate( const Parameters* parameters, int replicate );
+
+
+/**
+ * \brief    Main function
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int main( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read parameters                 */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Parameters* parameters = new Parameters();
+  int         replicates = 1;
+  int         threads    = (int)std::thread::hardware_concurrency();
+  readArgs(argc, argv, parameters, replicates, threads);
+  if (parameters->get_seed() == 0)
+  {
+    parameters->set_seed((unsigned long int)time(NULL));
+  }
+  if (threads <= 0)
+  {
+    threads = 1;
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Run the replicates              */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  signal(SIGTERM, stopHandler);
+  ThreadPool* pool = new ThreadPool(threads);
+  for (int r = 0; r < replicates; r++)
+  {
+    pool->submit([parameters, r]{ runReplicate(parameters, r); });
+  }
+  pool->wait();
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Free memory                     */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  delete pool;
+  pool = NULL;
+  delete parameters;
+  parameters = NULL;
+  
+  return EXIT_SUCCESS;
+}
+
+/**
+ * \brief    Read command line arguments
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \param    Parameters* parameters
+ * \param    int& replicates
+ * \param    int& threads
+ * \return   \e void
+ */
+void readArgs( int argc, char const** argv, Parameters* parameters, int& replicates, int& threads )
+{
+  if (argc == 1)
+  {
+    printf("You must provide all the mandatory arguments (see -h or --help). Exit.\n");
+    exit(EXIT_SUCCESS);
+  }
+  for (int i = 0; i < argc; i++)
+  {
+    /****************************************************************/
+    
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+    {
+      printUsage();
+      exit(EXIT_SUCCESS);
+    }
+    else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--version") == 0)
+    {
+      std::cout << PACKAGE << " (" << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << ")\n";
+      exit(EXIT_SUCCESS);
+    }
+    
+    /*----------------------------------------------- BATCH */
+    
+    else if (strcmp(argv[i], "-rep") == 0 || strcmp(argv[i], "--replicates") == 0)
+    {
+      if (i+1 == argc)
+      {
+        std::cout << "Error: command line parameter value is missing.\n";
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        replicates = atoi(argv[i+1]);
+      }
+    }
+    else if (strcmp(argv[i], "-threads") == 0 || strcmp(argv[i], "--threads") == 0)
+    {
+      if (i+1 == argc)
+      {
+        std::cout << "Error: command line parameter value is missing.\n";
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        threads = atoi(argv[i+1]);
+      }
+    }
+    
+    /****************************************************************/
+  }
+  if (!parameters->read_arguments(argc, argv))
+  {
+    printf("Error: %s. Exit.\n", parameters->get_arguments_error().c_str());
+    exit(EXIT_FAILURE);
+  }
+  if (!parameters->has_mandatory_arguments())
+  {
+    printf("You must provide all the mandatory arguments (see -h or --help). Exit.\n");
+    exit(EXIT_SUCCESS);
+  }
+  if (replicates < 1)
+  {
+    printf("Error: the number of replicates must be positive. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  if (parameters->get_resume_filename() != "")
+  {
+    printf("Error: option -resume is not available in batch mode. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * \brief    Print usage
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printUsage( void )
+{
+  printHeader();
+  std::cout << "Usage: SigmaFGM_batch -h or --help\n";
+  std::cout << "   or: SigmaFGM_batch [options]\n";
+  std::cout << "Options are:\n";
+  std::cout << "  -h, --help\n";
+  std::cout << "        print this help, then exit\n";
+  std::cout << "  -v, --version\n";
+  std::cout << "        print the current version, then exit\n";
+  std::cout << "  -rep, --replicates\n";
+  std::cout << "        specify the number of replicates R (replicate r uses seed+r and writes in <output>/rep_<r>, 1 by default)\n";
+  std::cout << "  -threads, --threads\n";
+  std::cout << "        specify the number of threads (number of cores by default)\n";
+  Parameters::print_arguments_usage();
+  std::cout << "On SIGTERM (or with -checkpoint), each unfinished replicate r saves <output>/rep_<r>/checkpoint.bin. Resume it with\n";
+  std::cout << "SigmaFGM_simulation, the same parameters, -output <output>/rep_<r> and -resume <output>/rep_<r>/checkpoint.bin\n";
+  std::cout << "(option -resume is not available in batch mode).\n";
+  std::cout << "\n";
+}
+
+/**
+ * \brief    Print header
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printHeader( void )
+{
+  std::cout << "\n";
+  std::cout << "*********************************************************************\n";
+#ifdef DEBUG
+  std::cout << " " << PACKAGE << " " << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << " ( debug )\n";
+#endif
+#ifdef NDEBUG
+  std::cout << " " << PACKAGE << " " << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << " ( release )\n";
+#endif
+  std::cout << "                                                                     \n";
+  std::cout << " Copyright (C) 2016-2020                                             \n";
+  std::cout << " Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard   \n";
+  std::cout << " Web: https://github.com/charlesrocabert/SigmaFGM/                   \n";
+  std::cout << "                                                                     \n";
+  std::cout << " This program comes with ABSOLUTELY NO WARRANTY.                     \n";
+  std::cout << " This is free software, and you are welcome to redistribute it under \n";
+  std::cout << " certain conditions; See the GNU General Public License for details  \n";
+  std::cout << "*********************************************************************\n";
+  std::cout << "\n";
+}
+
+/**
+ * \brief    Handle a stop signal
+ * \details  Every running replicate stops at the end of its current generation and saves a checkpoint
+ * \param    int signal_number
+ * \return   \e void
+ */
+void stopHandler( int signal_number )
+{
+  (void)signal_number;
+  Simulation::request_stop();
+}
+
+/**
+ * \brief    Run a replicate
+ * \details  The replicate owns a copy of the parameters (and thus its own PRNG), seeded with seed+replicate,
+ *           and writes its outputs in <output>/rep_<replicate>
+ * \param    const Parameters* parameters
+ * \param    int replicate
+ * \return   \e void
+ */
+void runReplicate( const Parameters* parameters, int replicate )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Set the replicate parameters    */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Parameters*       replicate_parameters = new Parameters(*parameters);
+  std::stringstream output_path;
+  output_path << parameters->get_output_path() << "/rep_" << replicate;
+  replicate_parameters->set_seed(parameters->get_seed()+(unsigned long int)replicate);
+  replicate_parameters->set_output_path(output_path.str());
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Create the simulation           */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Simulation* simulation = Simulation::create(replicate_parameters);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Stabilize and run               */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  simulation->execute();
+  if (simulation->is_interrupted())
+  {
+    printf("Replicate %d interrupted, checkpoint saved in %s.\n", replicate, replicate_parameters->get_output_filename(CHECKPOINT_FILE).c_str());
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Free memory                     */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  delete simulation;
+  simulation = NULL;
+  delete replicate_parameters;
+  replicate_parameters = NULL;
+}
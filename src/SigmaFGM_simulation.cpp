@@ -31,18 +31,59 @@
 
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <ctime>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 #include <cstring>
+#include <unistd.h>
 #include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <csignal>
 #include <assert.h>
 
 #include "./lib/Macros.h"
 #include "./lib/Enums.h"
 #include "./lib/Parameters.h"
 #include "./lib/Simulation.h"
+#include "./lib/ThreadPool.h"
+
+/**
+ * \brief   Worker channel
+ * \details Stream of jobs read from stdin or from a socket connection. Each job is answered on the channel when it finishes
+ */
+typedef struct
+{
+  int                     output;  /*!< File descriptor receiving the answers */
+  std::mutex              mutex;   /*!< Mutex protecting the channel         */
+  std::condition_variable done;    /*!< Signals that a job is finished       */
+  int                     pending; /*!< Number of jobs not answered yet      */
+} serve_channel;
+
+/**
+ * \brief   Worker state
+ * \details Shared by all the channels of the worker
+ */
+typedef struct
+{
+  unsigned long int     seed;    /*!< Worker seed, drawn at start (jobs without seed get seed+job count) */
+  unsigned long int     jobs;    /*!< Number of jobs started by the worker                                */
+  std::set<std::string> running; /*!< Output paths of the running jobs                                   */
+  std::mutex            mutex;   /*!< Mutex protecting the worker state                                   */
+} serve_worker;
 
 void readArgs( int argc, char const** argv, Parameters* parameters );
 void printUsage( void );
 void printHeader( void );
+void stopHandler( int signal_number );
+int  serve( int argc, char const** argv );
+void serveChannel( ThreadPool* pool, serve_worker* worker, int input, int output );
+void runServeJob( serve_worker* worker, serve_channel* channel, int job, std::string line );
+void answer( serve_channel* channel, std::string text );
 
 
 /**
@@ -54,6 +95,17 @@ void printHeader( void );
  */
 int main( int argc, char const** argv )
 {
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 0) Run as a worker if requested    */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-serve") == 0 || strcmp(argv[i], "--serve") == 0)
+    {
+      return serve(argc, argv);
+    }
+  }
+  
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   /* 1) Read parameters                 */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -67,34 +119,20 @@ int main( int argc, char const** argv )
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   /* 2) Create the simulation           */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  Simulation* simulation = new Simulation(parameters);
-  
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 3) Stabilize the population        */
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  if (parameters->get_number_of_stabilizing_generations() > 0)
-  {
-    simulation->stabilize(parameters->get_number_of_stabilizing_generations());
-  }
+  Simulation* simulation = Simulation::create(parameters);
+  signal(SIGTERM, stopHandler);
   
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 4) Run the simulation              */
+  /* 3) Stabilize and run               */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  if (parameters->get_shutoff_distance() == 0)
+  simulation->execute();
+  if (simulation->is_interrupted())
   {
-    simulation->run(parameters->get_number_of_generations());
+    std::cout << "Simulation interrupted, checkpoint saved in " << parameters->get_output_filename(CHECKPOINT_FILE) << ".\n";
   }
   
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 5) Run the simulation with shutoff */
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  if (parameters->get_shutoff_distance() > 0.0)
-  {
-    simulation->run_with_shutoff(parameters->get_shutoff_distance(), parameters->get_shutoff_generation());
-  }
-  
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 6) Free memory                     */
+  /* 4) Free memory                     */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   delete simulation;
   simulation = NULL;
@@ -119,7 +157,6 @@ void readArgs( int argc, char const** argv, Parameters* parameters )
     printf("You must provide all the mandatory arguments (see -h or --help). Exit.\n");
     exit(EXIT_SUCCESS);
   }
-  int counter = 0;
   for (int i = 0; i < argc; i++)
   {
     /****************************************************************/
@@ -135,315 +172,14 @@ void readArgs( int argc, char const** argv, Parameters* parameters )
       exit(EXIT_SUCCESS);
     }
     
-    /*----------------------------------------------- PSEUDORANDOM NUMBERS GENERATOR SEED */
-    
-    else if (strcmp(argv[i], "-seed") == 0 || strcmp(argv[i], "--seed") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_seed((unsigned long int)atoi(argv[i+1]));
-        counter++;
-      }
-    }
-    
-    /*----------------------------------------------- SIMULATION TIME */
-    
-    else if (strcmp(argv[i], "-stabg") == 0 || strcmp(argv[i], "--stabilizing-generations") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_number_of_stabilizing_generations(atoi(argv[i+1]));
-      }
-    }
-    else if (strcmp(argv[i], "-g") == 0 || strcmp(argv[i], "--generations") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_number_of_generations(atoi(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-shutoffd") == 0 || strcmp(argv[i], "--shutoff-distance") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_shutoff_distance(atof(argv[i+1]));
-      }
-    }
-    else if (strcmp(argv[i], "-shutoffg") == 0 || strcmp(argv[i], "--shutoff-generation") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_shutoff_generation(atoi(argv[i+1]));
-      }
-    }
-    
-    /*----------------------------------------------- PHENOTYPIC COMPLEXITY */
-    
-    else if (strcmp(argv[i], "-nbdim") == 0 || strcmp(argv[i], "--nb-dimensions") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_number_of_dimensions(atoi(argv[i+1]));
-        counter++;
-      }
-    }
-    
-    /*----------------------------------------------- FITNESS FUNCTION */
-    
-    else if (strcmp(argv[i], "-alpha") == 0 || strcmp(argv[i], "--alpha") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_alpha(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-beta") == 0 || strcmp(argv[i], "--beta") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_beta(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-Q") == 0 || strcmp(argv[i], "--Q") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_Q(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    
-    /*----------------------------------------------- POPULATION */
-    
-    else if (strcmp(argv[i], "-popsize") == 0 || strcmp(argv[i], "--population-size") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_population_size(atoi(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-initmu") == 0 || strcmp(argv[i], "--initial-mu") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_initial_mu(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-initsigma") == 0 || strcmp(argv[i], "--initial-sigma") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_initial_sigma(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-inittheta") == 0 || strcmp(argv[i], "--initial-theta") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_initial_theta(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-oneDshift") == 0 || strcmp(argv[i], "--oneD-shift") == 0)
-    {
-      parameters->set_oneD_shift(true);
-    }
-    else if (strcmp(argv[i], "-meanfitness") == 0 || strcmp(argv[i], "--mean-fitness") == 0)
-    {
-      parameters->set_mean_fitness(true);
-    }
-    
-    /*----------------------------------------------- MUTATIONS */
-    
-    else if (strcmp(argv[i], "-mmu") == 0 || strcmp(argv[i], "--m-mu") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_m_mu(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-msigma") == 0 || strcmp(argv[i], "--m-sigma") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_m_sigma(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-mtheta") == 0 || strcmp(argv[i], "--m-theta") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_m_theta(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-smu") == 0 || strcmp(argv[i], "--s-mu") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_s_mu(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-ssigma") == 0 || strcmp(argv[i], "--s-sigma") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_s_sigma(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    else if (strcmp(argv[i], "-stheta") == 0 || strcmp(argv[i], "--s-theta") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        parameters->set_s_theta(atof(argv[i+1]));
-        counter++;
-      }
-    }
-    
-    /*----------------------------------------------- NOISE PROPERTIES */
-    
-    else if (strcmp(argv[i], "-noise") == 0 || strcmp(argv[i], "--noise-type") == 0)
-    {
-      if (i+1 == argc)
-      {
-        std::cout << "Error: command line parameter value is missing.\n";
-        exit(EXIT_FAILURE);
-      }
-      else
-      {
-        if (strcmp(argv[i+1], "NONE") == 0)
-        {
-          parameters->set_noise_type(NONE);
-        }
-        else if (strcmp(argv[i+1], "ISOTROPIC") == 0)
-        {
-          parameters->set_noise_type(ISOTROPIC);
-        }
-        else if (strcmp(argv[i+1], "UNCORRELATED") == 0)
-        {
-          parameters->set_noise_type(UNCORRELATED);
-        }
-        else if (strcmp(argv[i+1], "FULL") == 0)
-        {
-          parameters->set_noise_type(FULL);
-        }
-        else
-        {
-          std::cout << "Error: wrong value for parameter -noise (--noise-type).\n";
-          exit(EXIT_FAILURE);
-        }
-        counter++;
-      }
-    }
-    
     /****************************************************************/
   }
-  if (counter < 17)
+  if (!parameters->read_arguments(argc, argv))
+  {
+    printf("Error: %s. Exit.\n", parameters->get_arguments_error().c_str());
+    exit(EXIT_FAILURE);
+  }
+  if (!parameters->has_mandatory_arguments())
   {
     printf("You must provide all the mandatory arguments (see -h or --help). Exit.\n");
     exit(EXIT_SUCCESS);
@@ -478,55 +214,19 @@ void printUsage( void )
   std::cout << "\n";
   std::cout << "Usage: SigmaFGM_simulation -h or --help\n";
   std::cout << "   or: SigmaFGM_simulation [options]\n";
+  std::cout << "   or: SigmaFGM_simulation -serve [-socket path] [-threads T]\n";
   std::cout << "Options are:\n";
   std::cout << "  -h, --help\n";
   std::cout << "        print this help, then exit\n";
   std::cout << "  -v, --version\n";
   std::cout << "        print the current version, then exit\n";
-  std::cout << "  -seed, --seed\n";
-  std::cout << "        specify the prng seed (mandatory, random if 0)\n";
-  std::cout << "  -stabg, --stabilizing-generations\n";
-  std::cout << "        specify the number of stabilizing generations\n";
-  std::cout << "  -g, --generations\n";
-  std::cout << "        specify the number of generations (mandatory)\n";
-  std::cout << "  -shutoffd, --shutoff-distance\n";
-  std::cout << "        specify the shutoff distance\n";
-  std::cout << "  -shutoffg, --shutoff-generation\n";
-  std::cout << "        specify the shutoff generation\n";
-  std::cout << "  -nbdim, --nb-dimensions\n";
-  std::cout << "        specify the number of dimensions (mandatory)\n";
-  std::cout << "  -alpha, --alpha\n";
-  std::cout << "        specify the alpha parameter of the fitness function (0.0 < mandatory)\n";
-  std::cout << "  -beta, --beta\n";
-  std::cout << "        specify the beta parameter of the fitness function (0.0 <= mandatory <= 1.0)\n";
-  std::cout << "  -Q, --Q\n";
-  std::cout << "        specify the Q parameter of the fitness function (0.0 <= mandatory)\n";
-  std::cout << "  -popsize, --population-size\n";
-  std::cout << "        specify the population size (mandatory)\n";
-  std::cout << "  -initmu, --initial-mu\n";
-  std::cout << "        specify the initial mu value (mandatory)\n";
-  std::cout << "  -initsigma, --initial-sigma\n";
-  std::cout << "        specify initial sigma value (mandatory)\n";
-  std::cout << "  -inittheta, --initial-theta\n";
-  std::cout << "        specify initial theta value (mandatory)\n";
-  std::cout << "  -oneDshift, --oneD-shift\n";
-  std::cout << "        Indicates if the initial population is shifted in a single dimension\n";
-  std::cout << "  -meanfitness, --mean-fitness\n";
-  std::cout << "        Indicates if the mean fitness should be computed (by sampling the phenotypes)\n";
-  std::cout << "  -mmu, --m-mu\n";
-  std::cout << "        specify mu mutation rate (mandatory)\n";
-  std::cout << "  -msigma, --m-sigma\n";
-  std::cout << "        specify sigma mutation rate (mandatory)\n";
-  std::cout << "  -mtheta, --m-theta\n";
-  std::cout << "        specify theta mutation rate (mandatory)\n";
-  std::cout << "  -smu, --s-mu\n";
-  std::cout << "        specify mu mutation size (mandatory)\n";
-  std::cout << "  -ssigma, --s-sigma\n";
-  std::cout << "        specify sigma mutation size (mandatory)\n";
-  std::cout << "  -stheta, --stheta\n";
-  std::cout << "        specify theta mutation size (mandatory)\n";
-  std::cout << "  -noise, --noise-type\n";
-  std::cout << "        Specify the type of noise (mandatory, NONE/ISOTROPIC/UNCORRELATED/FULL)\n";
+  std::cout << "  -serve, --serve\n";
+  std::cout << "        run as a persistent worker: each line read on stdin (or on the socket) is a job, given with the options below\n";
+  std::cout << "  -socket, --socket\n";
+  std::cout << "        in worker mode, read jobs from the connections of a Unix domain socket created at this path instead of stdin\n";
+  std::cout << "  -threads, --threads\n";
+  std::cout << "        in worker mode, specify the number of threads (number of cores by default)\n";
+  Parameters::print_arguments_usage();
   std::cout << "\n";
 }
 
@@ -557,3 +257,282 @@ void printHeader( void )
   std::cout << "*********************************************************************\n";
   std::cout << "\n";
 }
+
+/**
+ * \brief    Handle a stop signal
+ * \details  The simulation stops at the end of the current generation and saves a checkpoint
+ * \param    int signal_number
+ * \return   \e void
+ */
+void stopHandler( int signal_number )
+{
+  (void)signal_number;
+  Simulation::request_stop();
+}
+
+/**
+ * \brief    Run as a persistent worker
+ * \details  Jobs are read on stdin, or on the connections of a Unix domain socket, and run concurrently on a pool of threads
+ *           kept alive between jobs. Each job is a line of simulation options, and is answered by a line
+ *           "<job> ok <generation> <output path>" (or "<job> error <message>") on the same channel, in the order of completion.
+ *           Jobs are numbered from 1 on each channel. A job without seed (or with seed 0) gets the seed drawn at the start of
+ *           the worker plus the number of jobs started before it, and a job writing in the output path of a running job is
+ *           rejected
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int serve( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read worker options             */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::string socket_path = "";
+  int         threads     = (int)std::thread::hardware_concurrency();
+  for (int i = 1; i < argc; i++)
+  {
+    if ((strcmp(argv[i], "-socket") == 0 || strcmp(argv[i], "--socket") == 0) && i+1 < argc)
+    {
+      socket_path = argv[i+1];
+    }
+    else if ((strcmp(argv[i], "-threads") == 0 || strcmp(argv[i], "--threads") == 0) && i+1 < argc)
+    {
+      threads = atoi(argv[i+1]);
+    }
+  }
+  if (threads <= 0)
+  {
+    threads = 1;
+  }
+  signal(SIGPIPE, SIG_IGN);
+  ThreadPool*  pool = new ThreadPool(threads);
+  serve_worker worker;
+  worker.seed = (unsigned long int)time(NULL);
+  worker.jobs = 0;
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Serve stdin until end of file   */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (socket_path == "")
+  {
+    serveChannel(pool, &worker, STDIN_FILENO, STDOUT_FILENO);
+    delete pool;
+    pool = NULL;
+    return EXIT_SUCCESS;
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Else serve socket connections   */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  struct sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (socket_path.size() >= sizeof(address.sun_path))
+  {
+    printf("Error: socket path %s is too long. Exit.\n", socket_path.c_str());
+    exit(EXIT_FAILURE);
+  }
+  strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path)-1);
+  unlink(socket_path.c_str());
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listener == -1 || bind(listener, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 16) != 0)
+  {
+    printf("Error: impossible to listen on socket %s. Exit.\n", socket_path.c_str());
+    exit(EXIT_FAILURE);
+  }
+  while (true)
+  {
+    int connection = accept(listener, NULL, NULL);
+    if (connection == -1)
+    {
+      continue;
+    }
+    serve_worker* shared = &worker;
+    std::thread([pool, shared, connection]{ serveChannel(pool, shared, connection, connection); close(connection); }).detach();
+  }
+  return EXIT_SUCCESS;
+}
+
+/**
+ * \brief    Serve the jobs of a channel
+ * \details  Lines are read until the end of the input (empty lines and lines starting with '#' are ignored). The function
+ *           returns once every job of the channel has been answered
+ * \param    ThreadPool* pool
+ * \param    serve_worker* worker
+ * \param    int input
+ * \param    int output
+ * \return   \e void
+ */
+void serveChannel( ThreadPool* pool, serve_worker* worker, int input, int output )
+{
+  serve_channel channel;
+  channel.output  = output;
+  channel.pending = 0;
+  std::string buffer = "";
+  char        block[4096];
+  int         job    = 0;
+  bool        eof    = false;
+  while (!eof)
+  {
+    ssize_t length = read(input, block, sizeof(block));
+    if (length <= 0)
+    {
+      eof = true;
+      if (buffer == "")
+      {
+        break;
+      }
+      buffer += "\n";
+    }
+    else
+    {
+      buffer.append(block, (size_t)length);
+    }
+    size_t end = buffer.find('\n');
+    while (end != std::string::npos)
+    {
+      std::string line  = buffer.substr(0, end);
+      size_t      first = line.find_first_not_of(" \t\r");
+      buffer.erase(0, end+1);
+      end = buffer.find('\n');
+      if (first == std::string::npos || line[first] == '#')
+      {
+        continue;
+      }
+      job++;
+      {
+        std::lock_guard<std::mutex> lock(channel.mutex);
+        channel.pending++;
+      }
+      serve_channel* target = &channel;
+      pool->submit([worker, target, job, line]{ runServeJob(worker, target, job, line); });
+    }
+  }
+  std::unique_lock<std::mutex> lock(channel.mutex);
+  channel.done.wait(lock, [&channel]{ return channel.pending == 0; });
+}
+
+/**
+ * \brief    Run a job of a channel
+ * \details  The job is run as SigmaFGM_simulation would run it with the same options. Wrong options, an output path used by
+ *           a running job or a checkpoint that cannot be resumed are answered by an error, without stopping the worker
+ * \param    serve_worker* worker
+ * \param    serve_channel* channel
+ * \param    int job
+ * \param    std::string line
+ * \return   \e void
+ */
+void runServeJob( serve_worker* worker, serve_channel* channel, int job, std::string line )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read the job parameters         */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::vector<std::string> arguments;
+  std::vector<const char*> job_argv;
+  std::stringstream        flux(line);
+  std::stringstream        result;
+  std::string              word;
+  std::string              error = "";
+  while (flux >> word)
+  {
+    arguments.push_back(word);
+  }
+  job_argv.push_back("SigmaFGM_simulation");
+  for (size_t i = 0; i < arguments.size(); i++)
+  {
+    if (arguments[i] == "-h" || arguments[i] == "--help" || arguments[i] == "-v" || arguments[i] == "--version" || arguments[i] == "-serve" || arguments[i] == "--serve")
+    {
+      error = "option "+arguments[i]+" is not available in a job";
+    }
+    job_argv.push_back(arguments[i].c_str());
+  }
+  Parameters* parameters = new Parameters();
+  if (error == "" && !parameters->read_arguments((int)job_argv.size(), &job_argv[0]))
+  {
+    error = parameters->get_arguments_error();
+  }
+  if (error == "" && !parameters->has_mandatory_arguments())
+  {
+    error = "missing mandatory parameters";
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Reserve the output path         */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (error == "")
+  {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    if (worker->running.find(parameters->get_output_path()) != worker->running.end())
+    {
+      error = "output path "+parameters->get_output_path()+" is used by a running job";
+    }
+    else
+    {
+      worker->running.insert(parameters->get_output_path());
+      if (parameters->get_seed() == 0)
+      {
+        parameters->set_seed(worker->seed+worker->jobs);
+      }
+      worker->jobs++;
+    }
+  }
+  if (error != "")
+  {
+    result << job << " error " << error << "\n";
+    delete parameters;
+    parameters = NULL;
+    answer(channel, result.str());
+    return;
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Create the simulation           */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Simulation* simulation = Simulation::create(parameters, error);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Stabilize, run and answer       */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (simulation != NULL)
+  {
+    simulation->execute();
+    result << job << " ok " << simulation->get_generation() << " " << parameters->get_output_path() << "\n";
+    delete simulation;
+    simulation = NULL;
+  }
+  else
+  {
+    result << job << " error " << error << "\n";
+  }
+  {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    worker->running.erase(parameters->get_output_path());
+  }
+  delete parameters;
+  parameters = NULL;
+  answer(channel, result.str());
+}
+
+/**
+ * \brief    Answer a job on its channel
+ * \details  The answer is written in one piece, and the job is counted as finished
+ * \param    serve_channel* channel
+ * \param    std::string text
+ * \return   \e void
+ */
+void answer( serve_channel* channel, std::string text )
+{
+  std::lock_guard<std::mutex> lock(channel->mutex);
+  size_t written = 0;
+  while (written < text.size())
+  {
+    ssize_t length = write(channel->output, text.c_str()+written, text.size()-written);
+    if (length <= 0)
+    {
+      break;
+    }
+    written += (size_t)length;
+  }
+  channel->pending--;
+  channel->done.notify_all();
+}
@@ -0,0 +1,532 @@
+
+/**
+ * \file      SigmaFGM_sweep.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Run a parameter sweep from a grid specification
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "../cmake/Config.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <cstring>
+#include <sys/stat.h>
+#include <assert.h>
+
+#include "./lib/Macros.h"
+#include "./lib/Enums.h"
+#include "./lib/Parameters.h"
+#include "./lib/Simulation.h"
+#include "./lib/ThreadPool.h"
+
+/**
+ * \brief   Sweep job
+ * \details One replicate of one point of the parameter grid
+ */
+typedef struct
+{
+  int                      point;     /*!< Index of the grid point                       */
+  int                      replicate; /*!< Replicate index                               */
+  unsigned long int        seed;      /*!< Prng seed of the replicate                    */
+  std::vector<std::string> arguments; /*!< Command line arguments of the grid point      */
+  double                   cost;      /*!< Cost estimate (generations x N x n^2)         */
+  std::string              key;       /*!< Job key, as written in the manifest           */
+} sweep_job;
+
+void readArgs( int argc, char const** argv, std::string& spec_filename, int& replicates, int& threads, std::string& output_path );
+void printUsage( void );
+void printHeader( void );
+void loadSpecification( std::string spec_filename, std::vector< std::vector<std::string> >& points );
+void loadManifest( std::string manifest_filename, std::set<std::string>& completed );
+unsigned long int loadSweepSeed( std::string seed_filename );
+std::string computeJobKey( const std::vector<std::string>& arguments, int replicate );
+void runJob( const sweep_job* job, std::string output_path, std::ofstream* manifest, std::mutex* manifest_mutex );
+
+
+/**
+ * \brief    Main function
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int main( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read parameters                 */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::string spec_filename = "";
+  int         replicates    = 1;
+  int         threads       = (int)std::thread::hardware_concurrency();
+  std::string output_path   = ".";
+  readArgs(argc, argv, spec_filename, replicates, threads, output_path);
+  if (threads <= 0)
+  {
+    threads = 1;
+  }
+  mkdir(output_path.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+  
+  /* A seed of 0 is replaced by the sweep seed, drawn once and kept in the sweep directory */
+  unsigned long int sweep_seed = loadSweepSeed(output_path+"/sweep_seed.txt");
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Expand the grid into jobs       */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::vector< std::vector<std::string> > points;
+  std::set<std::string>                   completed;
+  std::vector<sweep_job>                  jobs;
+  loadSpecification(spec_filename, points);
+  loadManifest(output_path+"/manifest.txt", completed);
+  std::ofstream points_file((output_path+"/points.txt").c_str(), std::ios::out | std::ios::trunc);
+  for (size_t p = 0; p < points.size(); p++)
+  {
+    /*** Check the parameters of the grid point ***/
+    std::vector<const char*> point_argv;
+    point_argv.push_back(argv[0]);
+    points_file << p;
+    for (size_t i = 0; i < points[p].size(); i++)
+    {
+      point_argv.push_back(points[p][i].c_str());
+      points_file << " " << points[p][i];
+    }
+    points_file << "\n";
+    Parameters parameters;
+    if (!parameters.read_arguments((int)point_argv.size(), &point_argv[0]))
+    {
+      printf("Error: grid point %d: %s. Exit.\n", (int)p, parameters.get_arguments_error().c_str());
+      exit(EXIT_FAILURE);
+    }
+    if (!parameters.has_mandatory_arguments())
+    {
+      printf("Error: grid point %d does not define all the mandatory parameters. Exit.\n", (int)p);
+      exit(EXIT_FAILURE);
+    }
+    if (parameters.get_resume_filename() != "")
+    {
+      printf("Error: option -resume is not available in sweep mode. Exit.\n");
+      exit(EXIT_FAILURE);
+    }
+    double            n    = (double)parameters.get_number_of_dimensions();
+    double            cost = (double)(parameters.get_number_of_stabilizing_generations()+parameters.get_number_of_generations())*(double)parameters.get_population_size()*n*n;
+    unsigned long int seed = (parameters.get_seed() != 0 ? parameters.get_seed() : sweep_seed);
+    
+    /*** Create a job per replicate, unless already completed ***/
+    for (int r = 0; r < replicates; r++)
+    {
+      sweep_job job;
+      job.point     = (int)p;
+      job.replicate = r;
+      job.seed      = seed+(unsigned long int)r;
+      job.arguments = points[p];
+      job.cost      = cost;
+      job.key       = computeJobKey(points[p], r);
+      if (completed.find(job.key) == completed.end())
+      {
+        jobs.push_back(job);
+      }
+    }
+  }
+  points_file.close();
+  std::stable_sort(jobs.begin(), jobs.end(), [](const sweep_job& a, const sweep_job& b){ return a.cost > b.cost; });
+  std::cout << points.size()*replicates << " jobs, " << points.size()*replicates-jobs.size() << " already completed, " << jobs.size() << " to run on " << threads << " threads.\n";
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Run the jobs by decreasing cost */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::ofstream manifest((output_path+"/manifest.txt").c_str(), std::ios::out | std::ios::app);
+  std::mutex    manifest_mutex;
+  ThreadPool*   pool = new ThreadPool(threads);
+  for (size_t j = 0; j < jobs.size(); j++)
+  {
+    const sweep_job* job = &jobs[j];
+    pool->submit([job, output_path, &manifest, &manifest_mutex]{ runJob(job, output_path, &manifest, &manifest_mutex); });
+  }
+  pool->wait();
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Free memory                     */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  delete pool;
+  pool = NULL;
+  manifest.close();
+  
+  return EXIT_SUCCESS;
+}
+
+/**
+ * \brief    Read command line arguments
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \param    std::string& spec_filename
+ * \param    int& replicates
+ * \param    int& threads
+ * \param    std::string& output_path
+ * \return   \e void
+ */
+void readArgs( int argc, char const** argv, std::string& spec_filename, int& replicates, int& threads, std::string& output_path )
+{
+  if (argc == 1)
+  {
+    printf("You must provide all the mandatory arguments (see -h or --help). Exit.\n");
+    exit(EXIT_SUCCESS);
+  }
+  for (int i = 0; i < argc; i++)
+  {
+    /****************************************************************/
+    
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+    {
+      printUsage();
+      exit(EXIT_SUCCESS);
+    }
+    else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--version") == 0)
+    {
+      std::cout << PACKAGE << " (" << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << ")\n";
+      exit(EXIT_SUCCESS);
+    }
+    
+    /*----------------------------------------------- SWEEP */
+    
+    else if (strcmp(argv[i], "-spec") == 0 || strcmp(argv[i], "--specification") == 0)
+    {
+      if (i+1 == argc)
+      {
+        std::cout << "Error: command line parameter value is missing.\n";
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        spec_filename = argv[i+1];
+      }
+    }
+    else if (strcmp(argv[i], "-rep") == 0 || strcmp(argv[i], "--replicates") == 0)
+    {
+      if (i+1 == argc)
+      {
+        std::cout << "Error: command line parameter value is missing.\n";
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        replicates = atoi(argv[i+1]);
+      }
+    }
+    else if (strcmp(argv[i], "-threads") == 0 || strcmp(argv[i], "--threads") == 0)
+    {
+      if (i+1 == argc)
+      {
+        std::cout << "Error: command line parameter value is missing.\n";
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        threads = atoi(argv[i+1]);
+      }
+    }
+    else if (strcmp(argv[i], "-output") == 0 || strcmp(argv[i], "--output-path") == 0)
+    {
+      if (i+1 == argc)
+      {
+        std::cout << "Error: command line parameter value is missing.\n";
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        output_path = argv[i+1];
+      }
+    }
+    
+    /****************************************************************/
+  }
+  if (spec_filename == "")
+  {
+    printf("You must provide a grid specification file (see -h or --help). Exit.\n");
+    exit(EXIT_SUCCESS);
+  }
+  if (replicates < 1)
+  {
+    printf("Error: the number of replicates must be positive. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * \brief    Print usage
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printUsage( void )
+{
+  printHeader();
+  std::cout << "Usage: SigmaFGM_sweep -h or --help\n";
+  std::cout << "   or: SigmaFGM_sweep [options]\n";
+  std::cout << "Options are:\n";
+  std::cout << "  -h, --help\n";
+  std::cout << "        print this help, then exit\n";
+  std::cout << "  -v, --version\n";
+  std::cout << "        print the current version, then exit\n";
+  std::cout << "  -spec, --specification\n";
+  std::cout << "        specify the grid specification file (mandatory)\n";
+  std::cout << "        each line contains a simulation parameter followed by one or several values, e.g. \"-nbdim 1 2 5 10\"\n";
+  std::cout << "        the grid is the cartesian product of all the values, lines starting with # are ignored\n";
+  std::cout << "  -rep, --replicates\n";
+  std::cout << "        specify the number of replicates per grid point (replicate r uses seed+r, 1 by default)\n";
+  std::cout << "  -threads, --threads\n";
+  std::cout << "        specify the number of threads (number of cores by default)\n";
+  std::cout << "  -output, --output-path\n";
+  std::cout << "        specify the sweep directory (current directory by default)\n";
+  std::cout << "        grid points with seed 0 use the sweep seed, drawn at the first run and kept in <output>/sweep_seed.txt\n";
+  std::cout << "        each job is written in <output>/<key>, and listed in <output>/manifest.txt as \"<key> <point> <replicate> <seed>\"\n";
+  std::cout << "\n";
+}
+
+/**
+ * \brief    Print header
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printHeader( void )
+{
+  std::cout << "\n";
+  std::cout << "*********************************************************************\n";
+#ifdef DEBUG
+  std::cout << " " << PACKAGE << " " << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << " ( debug )\n";
+#endif
+#ifdef NDEBUG
+  std::cout << " " << PACKAGE << " " << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << " ( release )\n";
+#endif
+  std::cout << "                                                                     \n";
+  std::cout << " Copyright (C) 2016-2020                                             \n";
+  std::cout << " Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard   \n";
+  std::cout << " Web: https://github.com/charlesrocabert/SigmaFGM/                   \n";
+  std::cout << "                                                                     \n";
+  std::cout << " This program comes with ABSOLUTELY NO WARRANTY.                     \n";
+  std::cout << " This is free software, and you are welcome to redistribute it under \n";
+  std::cout << " certain conditions; See the GNU General Public License for details  \n";
+  std::cout << "*********************************************************************\n";
+  std::cout << "\n";
+}
+
+/**
+ * \brief    Load the grid specification and expand it into grid points
+ * \details  Each grid point is a list of command line arguments. The last lines of the file vary the fastest
+ * \param    std::string spec_filename
+ * \param    std::vector< std::vector<std::string> >& points
+ * \return   \e void
+ */
+void loadSpecification( std::string spec_filename, std::vector< std::vector<std::string> >& points )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read the parameter lines        */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::ifstream file(spec_filename.c_str(), std::ios::in);
+  if (!file)
+  {
+    printf("Error: impossible to open the grid specification file %s. Exit.\n", spec_filename.c_str());
+    exit(EXIT_FAILURE);
+  }
+  std::vector< std::vector<std::string> > lines;
+  std::string                             line;
+  while (std::getline(file, line))
+  {
+    std::stringstream        flux(line);
+    std::vector<std::string> words;
+    std::string              word;
+    while (flux >> word)
+    {
+      words.push_back(word);
+    }
+    if (words.size() == 0 || words[0][0] == '#')
+    {
+      continue;
+    }
+    lines.push_back(words);
+  }
+  file.close();
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Expand the cartesian product    */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  points.clear();
+  points.push_back(std::vector<std::string>());
+  for (size_t l = 0; l < lines.size(); l++)
+  {
+    std::vector< std::vector<std::string> > expanded;
+    for (size_t p = 0; p < points.size(); p++)
+    {
+      /*** Boolean option without value ***/
+      if (lines[l].size() == 1)
+      {
+        expanded.push_back(points[p]);
+        expanded.back().push_back(lines[l][0]);
+        continue;
+      }
+      for (size_t v = 1; v < lines[l].size(); v++)
+      {
+        expanded.push_back(points[p]);
+        expanded.back().push_back(lines[l][0]);
+        expanded.back().push_back(lines[l][v]);
+      }
+    }
+    points = expanded;
+  }
+}
+
+/**
+ * \brief    Load the keys of completed jobs from the manifest
+ * \details  The manifest is append-only, one completed job per line (key, grid point, replicate and seed)
+ * \param    std::string manifest_filename
+ * \param    std::set<std::string>& completed
+ * \return   \e void
+ */
+void loadManifest( std::string manifest_filename, std::set<std::string>& completed )
+{
+  std::ifstream file(manifest_filename.c_str(), std::ios::in);
+  std::string   line;
+  while (std::getline(file, line))
+  {
+    std::stringstream flux(line);
+    std::string       key;
+    if (flux >> key)
+    {
+      completed.insert(key);
+    }
+  }
+  file.close();
+}
+
+/**
+ * \brief    Load the seed of the sweep
+ * \details  The seed is drawn from the current time at the first run of the sweep, and saved in the file, so that a resumed
+ *           sweep gives its missing replicates the same seeds as the first run
+ * \param    std::string seed_filename
+ * \return   \e unsigned long int
+ */
+unsigned long int loadSweepSeed( std::string seed_filename )
+{
+  unsigned long int seed = 0;
+  std::ifstream     input(seed_filename.c_str(), std::ios::in);
+  if (input >> seed && seed != 0)
+  {
+    return seed;
+  }
+  input.close();
+  seed = (unsigned long int)time(NULL);
+  std::ofstream output(seed_filename.c_str(), std::ios::out | std::ios::trunc);
+  if (!output)
+  {
+    printf("Error: impossible to open file %s. Exit.\n", seed_filename.c_str());
+    exit(EXIT_FAILURE);
+  }
+  output << seed << "\n";
+  output.close();
+  return seed;
+}
+
+/**
+ * \brief    Compute the key of a job
+ * \details  FNV-1a hash of the grid point arguments and of the replicate index, so that a modified grid does not reuse old results
+ * \param    const std::vector<std::string>& arguments
+ * \param    int replicate
+ * \return   \e std::string
+ */
+std::string computeJobKey( const std::vector<std::string>& arguments, int replicate )
+{
+  std::stringstream job;
+  for (size_t i = 0; i < arguments.size(); i++)
+  {
+    job << arguments[i] << " ";
+  }
+  job << "rep " << replicate;
+  std::string            str = job.str();
+  unsigned long long int key = 14695981039346656037ULL;
+  for (size_t i = 0; i < str.size(); i++)
+  {
+    key ^= (unsigned long long int)(unsigned char)str[i];
+    key *= 1099511628211ULL;
+  }
+  std::stringstream key_str;
+  key_str << std::hex << std::setw(16) << std::setfill('0') << key;
+  return key_str.str();
+}
+
+/**
+ * \brief    Run a job
+ * \details  The job writes its outputs in <output>/<key>, and is recorded in the manifest with its seed once the simulation
+ *           is completed
+ * \param    const sweep_job* job
+ * \param    std::string output_path
+ * \param    std::ofstream* manifest
+ * \param    std::mutex* manifest_mutex
+ * \return   \e void
+ */
+void runJob( const sweep_job* job, std::string output_path, std::ofstream* manifest, std::mutex* manifest_mutex )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Set the job parameters          */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::vector<const char*> job_argv;
+  job_argv.push_back("SigmaFGM_sweep");
+  for (size_t i = 0; i < job->arguments.size(); i++)
+  {
+    job_argv.push_back(job->arguments[i].c_str());
+  }
+  Parameters* parameters = new Parameters();
+  parameters->read_arguments((int)job_argv.size(), &job_argv[0]);
+  parameters->set_seed(job->seed);
+  parameters->set_output_path(output_path+"/"+job->key);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Create the simulation           */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Simulation* simulation = Simulation::create(parameters);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Stabilize and run               */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  simulation->execute();
+  delete simulation;
+  simulation = NULL;
+  delete parameters;
+  parameters = NULL;
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Record the job in the manifest  */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::lock_guard<std::mutex> lock(*manifest_mutex);
+  *manifest << job->key << " " << job->point << " " << job->replicate << " " << job->seed << "\n";
+  manifest->flush();
+}
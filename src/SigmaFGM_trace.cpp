@@ -0,0 +1,326 @@
+
+/**
+ * \file      SigmaFGM_trace.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Conversion of an instrumentation trace to Chrome trace-event JSON
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "../cmake/Config.h"
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <assert.h>
+
+#include "./lib/Macros.h"
+#include "./lib/Enums.h"
+#include "./lib/Structs.h"
+
+/**
+ * \brief   Hardware counter names, in the order of hardware_counter
+ * \details --
+ */
+const char* const HW_COUNTER_NAMES[HW_COUNTERS] = {"cycles", "instructions", "L1D_misses", "LLC_misses", "branch_misses"};
+
+void readArgs( int argc, char const** argv, std::string& trace_filename, std::string& output_filename );
+void printUsage( void );
+void printHeader( void );
+
+
+/**
+ * \brief    Main function
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int main( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read parameters                 */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::string trace_filename  = TRACE_FILE;
+  std::string output_filename = "trace.json";
+  readArgs(argc, argv, trace_filename, output_filename);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Load the trace                  */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::ifstream trace_file(trace_filename.c_str(), std::ios::in | std::ios::binary);
+  if (!trace_file)
+  {
+    printf("Error: impossible to open trace file %s. Exit.\n", trace_filename.c_str());
+    exit(EXIT_FAILURE);
+  }
+  trace_header header;
+  trace_file.read((char*)&header, sizeof(trace_header));
+  if (!trace_file || strncmp(header.magic, TRACE_MAGIC, 8) != 0 || header.version != TRACE_VERSION)
+  {
+    printf("Error: %s is not a valid trace file. Exit.\n", trace_filename.c_str());
+    exit(EXIT_FAILURE);
+  }
+  std::vector<trace_zone_descriptor> zones(header.number_of_zones);
+  trace_file.read((char*)zones.data(), sizeof(trace_zone_descriptor)*header.number_of_zones);
+  std::vector<trace_record> records;
+  trace_record              record;
+  while (trace_file.read((char*)&record, sizeof(trace_record)))
+  {
+    if (record.zone < 0 || record.zone >= (long long int)header.number_of_zones)
+    {
+      printf("Error: trace file %s is corrupted. Exit.\n", trace_filename.c_str());
+      exit(EXIT_FAILURE);
+    }
+    records.push_back(record);
+  }
+  trace_file.close();
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Write the trace events          */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::ofstream output(output_filename.c_str(), std::ios::out | std::ios::trunc);
+  if (!output)
+  {
+    printf("Error: impossible to open file %s. Exit.\n", output_filename.c_str());
+    exit(EXIT_FAILURE);
+  }
+  output << std::fixed << std::setprecision(3);
+  output << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+  
+  /*** Name a track per timed zone ***/
+  bool first = true;
+  for (size_t zone = 0; zone < zones.size(); zone++)
+  {
+    if (zones[zone].timed)
+    {
+      output << (first ? "" : ",\n");
+      output << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << zone+1 << ", \"args\": {\"name\": \"" << zones[zone].name << "\"}}";
+      first = false;
+    }
+  }
+  
+  /*** Write the records of each generation ***/
+  size_t begin = 0;
+  while (begin < records.size())
+  {
+    size_t end      = begin;
+    double last_end = 0.0;
+    while (end < records.size() && records[end].phase == records[begin].phase && records[end].generation == records[begin].generation)
+    {
+      last_end = (records[end].end > last_end ? records[end].end : last_end);
+      end++;
+    }
+    for (size_t i = begin; i < end; i++)
+    {
+      const trace_record& current = records[i];
+      const char*         phase   = (current.phase == STABILIZATION ? "stabilization" : "evolution");
+      output << (first ? "" : ",\n");
+      if (zones[current.zone].timed)
+      {
+        /* Time window of the zone during the generation, with its busy time and number of calls */
+        output << "{\"name\": \"" << zones[current.zone].name << "\", \"cat\": \"" << phase << "\", \"ph\": \"X\", ";
+        output << "\"ts\": " << current.start << ", \"dur\": " << current.end-current.start << ", \"pid\": 1, \"tid\": " << current.zone+1 << ", ";
+        output << "\"args\": {\"generation\": " << current.generation << ", \"busy_ms\": " << current.busy/1000.0 << ", \"calls\": " << current.calls << ", ";
+        output << "\"allocations\": " << current.allocations << ", \"bytes\": " << current.bytes;
+        for (int counter = 0; counter < HW_COUNTERS && header.hardware_counters; counter++)
+        {
+          output << ", \"" << HW_COUNTER_NAMES[counter] << "\": " << current.counters[counter];
+        }
+        output << "}}";
+      }
+      else
+      {
+        /* Counters are reported at the end of the generation */
+        output << "{\"name\": \"" << zones[current.zone].name << "\", \"cat\": \"" << phase << "\", \"ph\": \"C\", ";
+        output << "\"ts\": " << last_end << ", \"pid\": 1, \"args\": {\"count\": " << current.calls << "}}";
+      }
+      first = false;
+    }
+    begin = end;
+  }
+  output << "\n]}\n";
+  output.close();
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Summarize each timed zone       */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::vector<trace_record> totals(zones.size());
+  memset(totals.data(), 0, sizeof(trace_record)*zones.size());
+  for (size_t i = 0; i < records.size(); i++)
+  {
+    totals[records[i].zone].busy        += records[i].busy;
+    totals[records[i].zone].calls       += records[i].calls;
+    totals[records[i].zone].allocations += records[i].allocations;
+    totals[records[i].zone].bytes       += records[i].bytes;
+    for (int counter = 0; counter < HW_COUNTERS; counter++)
+    {
+      totals[records[i].zone].counters[counter] += records[i].counters[counter];
+    }
+  }
+  double generations = (double)totals[TRACE_GENERATION].calls;
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << "Mean per generation (" << totals[TRACE_GENERATION].calls << " generations):\n";
+  std::cout << "zone busy_ms calls allocations bytes\n";
+  for (size_t zone = 0; zone < zones.size() && generations > 0.0; zone++)
+  {
+    if (zones[zone].timed && totals[zone].calls > 0)
+    {
+      std::cout << zones[zone].name << " " << totals[zone].busy/1000.0/generations << " " << totals[zone].calls/generations << " ";
+      std::cout << totals[zone].allocations/generations << " " << totals[zone].bytes/generations << "\n";
+    }
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 5) Summarize hardware counters     */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (header.hardware_counters)
+  {
+    std::cout << "\nHardware counters over the run (misses per thousand instructions):\n";
+    std::cout << "zone";
+    for (int counter = 0; counter < HW_COUNTERS; counter++)
+    {
+      std::cout << " " << HW_COUNTER_NAMES[counter];
+    }
+    std::cout << " IPC L1D_MPKI LLC_MPKI branch_MPKI\n";
+    for (size_t zone = 0; zone < zones.size(); zone++)
+    {
+      const unsigned long long int* counters = totals[zone].counters;
+      if (zones[zone].timed && totals[zone].calls > 0)
+      {
+        double kilo_instructions = (counters[HW_INSTRUCTIONS] > 0 ? counters[HW_INSTRUCTIONS]/1000.0 : 1.0);
+        std::cout << zones[zone].name;
+        for (int counter = 0; counter < HW_COUNTERS; counter++)
+        {
+          std::cout << " " << counters[counter];
+        }
+        std::cout << " " << (counters[HW_CYCLES] > 0 ? (double)counters[HW_INSTRUCTIONS]/counters[HW_CYCLES] : 0.0);
+        std::cout << " " << counters[HW_L1D_MISSES]/kilo_instructions << " " << counters[HW_LLC_MISSES]/kilo_instructions;
+        std::cout << " " << counters[HW_BRANCH_MISSES]/kilo_instructions << "\n";
+      }
+    }
+  }
+  
+  return EXIT_SUCCESS;
+}
+
+/**
+ * \brief    Read command line arguments
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \param    std::string& trace_filename
+ * \param    std::string& output_filename
+ * \return   \e void
+ */
+void readArgs( int argc, char const** argv, std::string& trace_filename, std::string& output_filename )
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+    {
+      printUsage();
+      exit(EXIT_SUCCESS);
+    }
+    else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--version") == 0)
+    {
+      std::cout << PACKAGE << " (" << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << ")\n";
+      exit(EXIT_SUCCESS);
+    }
+    else if (i+1 == argc)
+    {
+      std::cout << "Error: command line parameter value is missing.\n";
+      exit(EXIT_FAILURE);
+    }
+    else if (strcmp(argv[i], "-trace") == 0 || strcmp(argv[i], "--trace") == 0)
+    {
+      trace_filename = argv[++i];
+    }
+    else if (strcmp(argv[i], "-output") == 0 || strcmp(argv[i], "--output") == 0)
+    {
+      output_filename = argv[++i];
+    }
+    else
+    {
+      printf("Error: unknown option %s (see -h or --help). Exit.\n", argv[i]);
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+/**
+ * \brief    Print usage
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printUsage( void )
+{
+  printHeader();
+  std::cout << "Usage: SigmaFGM_trace -h or --help\n";
+  std::cout << "   or: SigmaFGM_trace [options]\n";
+  std::cout << "Converts an instrumentation trace to Chrome trace-event JSON (chrome://tracing, Perfetto),\n";
+  std::cout << "and prints the mean time, calls and heap allocations of each zone per generation (and its hardware counters\n";
+  std::cout << "over the run, if recorded)\n";
+  std::cout << "Options are:\n";
+  std::cout << "  -h, --help\n";
+  std::cout << "        print this help, then exit\n";
+  std::cout << "  -v, --version\n";
+  std::cout << "        print the current version, then exit\n";
+  std::cout << "  -trace, --trace\n";
+  std::cout << "        specify the trace file (" << TRACE_FILE << " by default)\n";
+  std::cout << "  -output, --output\n";
+  std::cout << "        specify the JSON output file (trace.json by default)\n";
+  std::cout << "\n";
+}
+
+/**
+ * \brief    Print header
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printHeader( void )
+{
+  std::cout << "\n";
+  std::cout << "*********************************************************************\n";
+#ifdef DEBUG
+  std::cout << " " << PACKAGE << " " << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << " ( debug )\n";
+#endif
+#ifdef NDEBUG
+  std::cout << " " << PACKAGE << " " << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << " ( release )\n";
+#endif
+  std::cout << "                                                                     \n";
+  std::cout << " Copyright (C) 2016-2020                                             \n";
+  std::cout << " Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard   \n";
+  std::cout << " Web: https://github.com/charlesrocabert/SigmaFGM/                   \n";
+  std::cout << "                                                                     \n";
+  std::cout << " This program comes with ABSOLUTELY NO WARRANTY.                     \n";
+  std::cout << " This is free software, and you are welcome to redistribute it under \n";
+  std::cout << " certain conditions; See the GNU General Public License for details  \n";
+  std::cout << "*********************************************************************\n";
+  std::cout << "\n";
+}
@@ -0,0 +1,310 @@
+
+/**
+ * \file      bench_individual.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Microbenchmarks of the Individual hot path
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "../../cmake/Config.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <assert.h>
+
+#include "../lib/Macros.h"
+#include "../lib/Enums.h"
+#include "../lib/Prng.h"
+#include "../lib/Individual.h"
+#include "../lib/AllocationCounter.h"
+
+
+/**
+ * \brief   Benchmarked operations
+ * \details --
+ */
+enum bench_operation
+{
+  MUTATE               = 0, /*!< Individual::mutate (every mutation rate is 1)       */
+  BUILD_PHENOTYPE      = 1, /*!< Individual::build_phenotype (Sigma, Cholesky and z) */
+  DRAW_Z               = 2, /*!< Individual::draw_z                                  */
+  COMPUTE_FITNESS      = 3, /*!< Individual::compute_fitness                         */
+  COMPUTE_MEAN_FITNESS = 4  /*!< Individual::compute_mean_fitness                    */
+};
+
+/**
+ * \brief   Benchmarked individual
+ * \details Exposes the protected steps of the phenotype build
+ */
+class BenchIndividual : public Individual
+{
+public:
+  BenchIndividual( Prng* prng, int n, type_of_noise noise_type, gsl_vector* z_opt ) : Individual(prng, n, 1.0, 0.1, 0.1, false, noise_type, z_opt) {}
+  void rebuild_phenotype( void ) { _phenotype_is_built = false; build_phenotype(); }
+  using Individual::draw_z;
+};
+
+/**
+ * \brief   Benchmark result
+ * \details --
+ */
+typedef struct
+{
+  long long int iterations;         /*!< Number of timed calls           */
+  double        ns_per_op;          /*!< Mean time per call (ns)         */
+  double        allocations_per_op; /*!< Mean heap allocations per call  */
+} bench_result;
+
+const int         NUMBER_OF_OPERATIONS = 5;
+const char* const OPERATION_NAMES[]    = {"mutate", "build_phenotype", "draw_z", "compute_fitness", "compute_mean_fitness"};
+const int         NUMBER_OF_SIZES      = 7;
+const int         SIZES[]              = {1, 2, 5, 10, 20, 50, 100};
+const char* const NOISE_NAMES[]        = {"NONE", "ISOTROPIC", "UNCORRELATED", "FULL"};
+
+void         readArgs( int argc, char const** argv, unsigned long int& seed, double& min_time, std::string& output );
+void         printUsage( void );
+void         runOperation( BenchIndividual* individual, bench_operation operation );
+bench_result runBenchmark( BenchIndividual* individual, bench_operation operation, double min_time );
+
+
+/**
+ * \brief    Main function
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int main( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read parameters                 */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  unsigned long int seed     = 1;
+  double            min_time = 0.2;
+  std::string       output   = "";
+  readArgs(argc, argv, seed, min_time, output);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Run the benchmarks              */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::stringstream json;
+  json << "{\n";
+  json << "  \"benchmark\": \"bench_individual\",\n";
+  json << "  \"version\": \"" << VERSION_MAJOR << "." << VERSION_MINOR << "." << VERSION_PATCH << "\",\n";
+  json << "  \"seed\": " << seed << ",\n";
+  json << "  \"allocations_counted\": " << (AllocationCounter::is_enabled() ? "true" : "false") << ",\n";
+  json << "  \"results\": [\n";
+  bool first = true;
+  for (int noise = NONE; noise <= FULL; noise++)
+  {
+    for (int s = 0; s < NUMBER_OF_SIZES; s++)
+    {
+      Prng*       prng  = new Prng();
+      gsl_vector* z_opt = gsl_vector_calloc(SIZES[s]);
+      prng->set_seed(seed);
+      BenchIndividual* individual = new BenchIndividual(prng, SIZES[s], (type_of_noise)noise, z_opt);
+      individual->build_phenotype();
+      for (int op = 0; op < NUMBER_OF_OPERATIONS; op++)
+      {
+        bench_result result = runBenchmark(individual, (bench_operation)op, min_time);
+        json << (first ? "" : ",\n");
+        json << "    {\"operation\": \"" << OPERATION_NAMES[op] << "\", ";
+        json << "\"noise\": \"" << NOISE_NAMES[noise] << "\", ";
+        json << "\"n\": " << SIZES[s] << ", ";
+        json << "\"iterations\": " << result.iterations << ", ";
+        json << "\"ns_per_op\": " << result.ns_per_op << ", ";
+        json << "\"allocations_per_op\": " << result.allocations_per_op << "}";
+        first = false;
+        std::cerr << OPERATION_NAMES[op] << " " << NOISE_NAMES[noise] << " n=" << SIZES[s] << ": " << result.ns_per_op << " ns/op, " << result.allocations_per_op << " allocations/op\n";
+      }
+      delete individual;
+      individual = NULL;
+      gsl_vector_free(z_opt);
+      z_opt = NULL;
+      delete prng;
+      prng = NULL;
+    }
+  }
+  json << "\n  ]\n";
+  json << "}\n";
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Write the results               */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (output == "")
+  {
+    std::cout << json.str();
+  }
+  else
+  {
+    std::ofstream file(output.c_str(), std::ios::out | std::ios::trunc);
+    if (!file)
+    {
+      printf("Error: impossible to open file %s. Exit.\n", output.c_str());
+      exit(EXIT_FAILURE);
+    }
+    file << json.str();
+    file.close();
+  }
+  
+  return EXIT_SUCCESS;
+}
+
+/**
+ * \brief    Read command line arguments
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \param    unsigned long int& seed
+ * \param    double& min_time
+ * \param    std::string& output
+ * \return   \e void
+ */
+void readArgs( int argc, char const** argv, unsigned long int& seed, double& min_time, std::string& output )
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+    {
+      printUsage();
+      exit(EXIT_SUCCESS);
+    }
+    else if (i+1 == argc)
+    {
+      std::cout << "Error: command line parameter value is missing.\n";
+      exit(EXIT_FAILURE);
+    }
+    else if (strcmp(argv[i], "-seed") == 0 || strcmp(argv[i], "--seed") == 0)
+    {
+      seed = (unsigned long int)atol(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-mintime") == 0 || strcmp(argv[i], "--min-time") == 0)
+    {
+      min_time = atof(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-output") == 0 || strcmp(argv[i], "--output") == 0)
+    {
+      output = argv[++i];
+    }
+    else
+    {
+      printf("Error: unknown option %s (see -h or --help). Exit.\n", argv[i]);
+      exit(EXIT_FAILURE);
+    }
+  }
+  if (seed == 0 || min_time <= 0.0)
+  {
+    printf("Error: the seed and the minimal time must be positive. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * \brief    Print usage
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printUsage( void )
+{
+  std::cout << "Usage: bench_individual -h or --help\n";
+  std::cout << "   or: bench_individual [options]\n";
+  std::cout << "Times Individual methods for n in {1, 2, 5, 10, 20, 50, 100} and each type of noise, and writes the results in JSON\n";
+  std::cout << "Options are:\n";
+  std::cout << "  -h, --help\n";
+  std::cout << "        print this help, then exit\n";
+  std::cout << "  -seed, --seed\n";
+  std::cout << "        specify the prng seed (1 by default)\n";
+  std::cout << "  -mintime, --min-time\n";
+  std::cout << "        specify the minimal duration of each measure in seconds (0.2 by default)\n";
+  std::cout << "  -output, --output\n";
+  std::cout << "        specify the JSON output file (standard output by default)\n";
+}
+
+/**
+ * \brief    Run a benchmarked operation once
+ * \details  --
+ * \param    BenchIndividual* individual
+ * \param    bench_operation operation
+ * \return   \e void
+ */
+void runOperation( BenchIndividual* individual, bench_operation operation )
+{
+  switch (operation)
+  {
+    case MUTATE:
+      individual->mutate(1.0, 1.0, 1.0, 0.01, 0.01, 0.01);
+      break;
+    case BUILD_PHENOTYPE:
+      individual->rebuild_phenotype();
+      break;
+    case DRAW_Z:
+      individual->draw_z();
+      break;
+    case COMPUTE_FITNESS:
+      individual->compute_fitness(0.5, 0.0, 2.0);
+      break;
+    case COMPUTE_MEAN_FITNESS:
+      individual->compute_mean_fitness(0.5, 0.0, 2.0);
+      break;
+  }
+}
+
+/**
+ * \brief    Time a benchmarked operation
+ * \details  The number of calls is increased until the measure lasts at least min_time
+ * \param    BenchIndividual* individual
+ * \param    bench_operation operation
+ * \param    double min_time
+ * \return   \e bench_result
+ */
+bench_result runBenchmark( BenchIndividual* individual, bench_operation operation, double min_time )
+{
+  bench_result  result;
+  long long int iterations = 1;
+  while (true)
+  {
+    unsigned long long int                first_allocation = AllocationCounter::get_allocations();
+    std::chrono::steady_clock::time_point start            = std::chrono::steady_clock::now();
+    for (long long int i = 0; i < iterations; i++)
+    {
+      runOperation(individual, operation);
+    }
+    double elapsed            = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+    result.iterations         = iterations;
+    result.ns_per_op          = 1e9*elapsed/iterations;
+    result.allocations_per_op = (AllocationCounter::is_enabled() ? (double)(AllocationCounter::get_allocations()-first_allocation)/iterations : -1.0);
+    if (elapsed >= min_time)
+    {
+      return result;
+    }
+    double factor = (elapsed > 0.0 ? 1.5*min_time/elapsed : 100.0);
+    iterations    = (long long int)(iterations*(factor < 2.0 ? 2.0 : (factor > 100.0 ? 100.0 : factor)));
+  }
+}
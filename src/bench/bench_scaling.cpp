@@ -0,0 +1,402 @@
+
+/**
+ * \file      bench_scaling.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Thread scaling study of the parallel engine
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "../../cmake/Config.h"
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+#include <assert.h>
+
+#include "../lib/Macros.h"
+#include "../lib/Enums.h"
+#include "../lib/Structs.h"
+#include "../lib/Parameters.h"
+#include "../lib/Simulation.h"
+#include "../lib/Snapshot.h"
+#include "../lib/ThreadPool.h"
+
+/**
+ * \brief   Scaling measure
+ * \details --
+ */
+typedef struct
+{
+  std::string mode;       /*!< "strong" or "weak"                    */
+  int         threads;    /*!< Number of threads                     */
+  int         replicates; /*!< Number of replicates                  */
+  double      time;       /*!< Wall time (s)                         */
+  double      speedup;    /*!< Speedup relative to one thread        */
+  double      efficiency; /*!< Parallel efficiency (speedup/threads) */
+} scaling_measure;
+
+void                   readArgs( int argc, char const** argv, Parameters* parameters, int& max_threads, int& replicates_per_thread, std::string& output );
+void                   printUsage( void );
+unsigned long long int hashBlock( unsigned long long int hash, const char* block, unsigned long long int size );
+unsigned long long int runReplicate( const Parameters* parameters, int replicate );
+double                 runReplicates( const Parameters* parameters, int threads, int replicates, std::vector<unsigned long long int>& fingerprints );
+
+
+/**
+ * \brief    Main function
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int main( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read parameters                 */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Parameters* parameters            = new Parameters();
+  int         max_threads           = (int)std::thread::hardware_concurrency();
+  int         replicates_per_thread = 1;
+  std::string output                = "bench_scaling.txt";
+  readArgs(argc, argv, parameters, max_threads, replicates_per_thread, output);
+  if (parameters->get_seed() == 0)
+  {
+    parameters->set_seed((unsigned long int)time(NULL));
+  }
+  if (max_threads <= 0)
+  {
+    max_threads = 1;
+  }
+  std::vector<int> thread_counts;
+  for (int threads = 1; threads < max_threads; threads *= 2)
+  {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(max_threads);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Run the strong scaling study    */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::vector<scaling_measure>        measures;
+  std::vector<unsigned long long int> reference;
+  bool                                identical             = true;
+  int                                 strong_replicates     = max_threads*replicates_per_thread;
+  double                              strong_reference_time = 0.0;
+  for (size_t i = 0; i < thread_counts.size(); i++)
+  {
+    std::vector<unsigned long long int> fingerprints;
+    scaling_measure measure;
+    measure.mode       = "strong";
+    measure.threads    = thread_counts[i];
+    measure.replicates = strong_replicates;
+    measure.time       = runReplicates(parameters, thread_counts[i], strong_replicates, fingerprints);
+    if (i == 0)
+    {
+      strong_reference_time = measure.time;
+      reference             = fingerprints;
+    }
+    measure.speedup    = (measure.time > 0.0 ? strong_reference_time/measure.time : 0.0);
+    measure.efficiency = measure.speedup/thread_counts[i];
+    identical = identical && (fingerprints == reference);
+    measures.push_back(measure);
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Run the weak scaling study      */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  double weak_reference_time = 0.0;
+  for (size_t i = 0; i < thread_counts.size(); i++)
+  {
+    std::vector<unsigned long long int> fingerprints;
+    scaling_measure measure;
+    measure.mode       = "weak";
+    measure.threads    = thread_counts[i];
+    measure.replicates = thread_counts[i]*replicates_per_thread;
+    measure.time       = runReplicates(parameters, thread_counts[i], measure.replicates, fingerprints);
+    if (i == 0)
+    {
+      weak_reference_time = measure.time;
+    }
+    measure.efficiency = (measure.time > 0.0 ? weak_reference_time/measure.time : 0.0);
+    measure.speedup    = measure.efficiency*thread_counts[i];
+    identical = identical && std::equal(fingerprints.begin(), fingerprints.end(), reference.begin());
+    measures.push_back(measure);
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Write the results               */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::ofstream file(output.c_str(), std::ios::out | std::ios::trunc);
+  if (!file)
+  {
+    printf("Error: impossible to open file %s. Exit.\n", output.c_str());
+    exit(EXIT_FAILURE);
+  }
+  file << "mode threads replicates time speedup efficiency\n";
+  for (size_t i = 0; i < measures.size(); i++)
+  {
+    if (i == 0 || measures[i].mode != measures[i-1].mode)
+    {
+      std::cout << "\n" << (measures[i].mode == "strong" ? "Strong" : "Weak") << " scaling (N=" << parameters->get_population_size() << ", ";
+      std::cout << (measures[i].mode == "strong" ? "fixed number of replicates" : "replicates proportional to threads") << "):\n";
+      std::cout << std::setw(8) << "threads" << std::setw(12) << "replicates" << std::setw(12) << "time (s)" << std::setw(10) << "speedup" << std::setw(12) << "efficiency" << "\n";
+    }
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::setw(8) << measures[i].threads << std::setw(12) << measures[i].replicates << std::setw(12) << measures[i].time << std::setw(10) << measures[i].speedup << std::setw(12) << measures[i].efficiency << "\n";
+    file << measures[i].mode << " " << measures[i].threads << " " << measures[i].replicates << " " << measures[i].time << " " << measures[i].speedup << " " << measures[i].efficiency << "\n";
+  }
+  file.close();
+  std::cout << "\nResults are " << (identical ? "identical" : "NOT identical") << " across thread counts.\n";
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 5) Free memory                     */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  delete parameters;
+  parameters = NULL;
+  
+  return (identical ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * \brief    Read command line arguments
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \param    Parameters* parameters
+ * \param    int& max_threads
+ * \param    int& replicates_per_thread
+ * \param    std::string& output
+ * \return   \e void
+ */
+void readArgs( int argc, char const** argv, Parameters* parameters, int& max_threads, int& replicates_per_thread, std::string& output )
+{
+  if (argc == 1)
+  {
+    printf("You must provide all the mandatory arguments (see -h or --help). Exit.\n");
+    exit(EXIT_SUCCESS);
+  }
+  for (int i = 0; i < argc; i++)
+  {
+    /****************************************************************/
+    
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+    {
+      printUsage();
+      exit(EXIT_SUCCESS);
+    }
+    
+    /*----------------------------------------------- SCALING */
+    
+    else if (strcmp(argv[i], "-maxthreads") == 0 || strcmp(argv[i], "--max-threads") == 0)
+    {
+      if (i+1 == argc)
+      {
+        std::cout << "Error: command line parameter value is missing.\n";
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        max_threads = atoi(argv[i+1]);
+      }
+    }
+    else if (strcmp(argv[i], "-rep") == 0 || strcmp(argv[i], "--replicates") == 0)
+    {
+      if (i+1 == argc)
+      {
+        std::cout << "Error: command line parameter value is missing.\n";
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        replicates_per_thread = atoi(argv[i+1]);
+      }
+    }
+    else if (strcmp(argv[i], "-scaling-output") == 0 || strcmp(argv[i], "--scaling-output") == 0)
+    {
+      if (i+1 == argc)
+      {
+        std::cout << "Error: command line parameter value is missing.\n";
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        output = argv[i+1];
+      }
+    }
+    
+    /****************************************************************/
+  }
+  if (!parameters->read_arguments(argc, argv))
+  {
+    printf("Error: %s. Exit.\n", parameters->get_arguments_error().c_str());
+    exit(EXIT_FAILURE);
+  }
+  if (!parameters->has_mandatory_arguments())
+  {
+    printf("You must provide all the mandatory arguments (see -h or --help). Exit.\n");
+    exit(EXIT_SUCCESS);
+  }
+  if (replicates_per_thread < 1)
+  {
+    printf("Error: the number of replicates per thread must be positive. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  if (parameters->get_resume_filename() != "")
+  {
+    printf("Error: option -resume is not available in scaling mode. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * \brief    Print usage
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printUsage( void )
+{
+  std::cout << "Usage: bench_scaling -h or --help\n";
+  std::cout << "   or: bench_scaling [options]\n";
+  std::cout << "Runs replicates of a simulation on 1, 2, 4, ... threads, up to the number of cores, and reports strong scaling\n";
+  std::cout << "(fixed number of replicates) and weak scaling (number of replicates proportional to threads)\n";
+  std::cout << "Options are:\n";
+  std::cout << "  -h, --help\n";
+  std::cout << "        print this help, then exit\n";
+  std::cout << "  -maxthreads, --max-threads\n";
+  std::cout << "        specify the largest number of threads (number of cores by default)\n";
+  std::cout << "  -rep, --replicates\n";
+  std::cout << "        specify the number of replicates per thread (1 by default)\n";
+  std::cout << "  -scaling-output, --scaling-output\n";
+  std::cout << "        specify the results file (bench_scaling.txt by default)\n";
+  Parameters::print_arguments_usage();
+  std::cout << "\n";
+}
+
+/**
+ * \brief    Hash a block of memory
+ * \details  64 bits FNV-1a
+ * \param    unsigned long long int hash
+ * \param    const char* block
+ * \param    unsigned long long int size
+ * \return   \e unsigned long long int
+ */
+unsigned long long int hashBlock( unsigned long long int hash, const char* block, unsigned long long int size )
+{
+  for (unsigned long long int i = 0; i < size; i++)
+  {
+    hash ^= (unsigned char)block[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/**
+ * \brief    Run a replicate
+ * \details  The replicate owns a copy of the parameters, seeded with seed+replicate as in SigmaFGM_batch, and writes no
+ *           file. Returns a fingerprint of the final population
+ * \param    const Parameters* parameters
+ * \param    int replicate
+ * \return   \e unsigned long long int
+ */
+unsigned long long int runReplicate( const Parameters* parameters, int replicate )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Set the replicate parameters    */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Parameters* replicate_parameters = new Parameters(*parameters);
+  replicate_parameters->set_seed(parameters->get_seed()+(unsigned long int)replicate);
+  replicate_parameters->set_file_output(false);
+  replicate_parameters->set_snapshot_interval(0);
+  replicate_parameters->set_checkpoint_interval(0);
+  replicate_parameters->set_stabilization_cache("");
+  replicate_parameters->set_lineage_tracking(false);
+  replicate_parameters->set_line_of_descent_depth(0);
+  replicate_parameters->set_telemetry_interval(0);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Stabilize and run               */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Simulation* simulation = new Simulation(replicate_parameters);
+  simulation->execute();
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Fingerprint the population      */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Snapshot* snapshot = new Snapshot(replicate_parameters);
+  snapshot->gather(simulation->get_population(), simulation->get_generation());
+  const snapshot_header* header      = snapshot->get_header();
+  const char*            buffer      = snapshot->get_buffer();
+  unsigned long long int N           = (unsigned long long int)header->population_size;
+  unsigned long long int hash        = 14695981039346656037ULL;
+  hash = hashBlock(hash, buffer+header->identifier_offset, N*sizeof(unsigned long long int));
+  hash = hashBlock(hash, buffer+header->mu_offset, N*header->mu_size*sizeof(double));
+  hash = hashBlock(hash, buffer+header->sigma_offset, N*header->sigma_size*sizeof(double));
+  hash = hashBlock(hash, buffer+header->theta_offset, N*header->theta_size*sizeof(double));
+  hash = hashBlock(hash, buffer+header->z_offset, N*header->z_size*sizeof(double));
+  hash = hashBlock(hash, buffer+header->Wz_offset, N*sizeof(double));
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Free memory                     */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  delete snapshot;
+  snapshot = NULL;
+  delete simulation;
+  simulation = NULL;
+  delete replicate_parameters;
+  replicate_parameters = NULL;
+  return hash;
+}
+
+/**
+ * \brief    Run replicates on a pool of threads
+ * \details  Returns the wall time, and the fingerprint of each replicate
+ * \param    const Parameters* parameters
+ * \param    int threads
+ * \param    int replicates
+ * \param    std::vector<unsigned long long int>& fingerprints
+ * \return   \e double
+ */
+double runReplicates( const Parameters* parameters, int threads, int replicates, std::vector<unsigned long long int>& fingerprints )
+{
+  fingerprints.assign(replicates, 0);
+  unsigned long long int* results = fingerprints.data();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  ThreadPool* pool = new ThreadPool(threads);
+  for (int r = 0; r < replicates; r++)
+  {
+    pool->submit([parameters, r, results]{ results[r] = runReplicate(parameters, r); });
+  }
+  pool->wait();
+  delete pool;
+  pool = NULL;
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+}
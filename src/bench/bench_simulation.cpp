@@ -0,0 +1,416 @@
+
+/**
+ * \file      bench_simulation.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     End-to-end benchmark scenarios, with regression comparison
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "../../cmake/Config.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <assert.h>
+
+#include "../lib/Macros.h"
+#include "../lib/Enums.h"
+#include "../lib/Parameters.h"
+#include "../lib/Simulation.h"
+#include "../tests/TestParameters.h"
+
+/**
+ * \brief   Benchmark scenario
+ * \details --
+ */
+typedef struct
+{
+  int           population_size;      /*!< Number of individuals (N)       */
+  int           number_of_dimensions; /*!< Number of dimensions (n)        */
+  type_of_noise noise_type;           /*!< Type of phenotypic noise        */
+  bool          mean_fitness;         /*!< The mean fitness is computed    */
+  double        time;                 /*!< Wall time of the evolution (s)  */
+  double        generations_per_s;    /*!< Throughput                      */
+  double        peak_rss;             /*!< Peak resident memory (MB)       */
+} bench_scenario;
+
+const int         NUMBER_OF_POPULATION_SIZES = 4;
+const int         POPULATION_SIZES[]         = {100, 1000, 10000, 100000};
+const int         NUMBER_OF_DIMENSIONS       = 3;
+const int         DIMENSIONS[]               = {1, 10, 50};
+const char* const NOISE_NAMES[]              = {"NONE", "ISOTROPIC", "UNCORRELATED", "FULL"};
+
+void        readArgs( int argc, char const** argv, unsigned long int& seed, int& generations, int& max_population_size, int& max_dimensions, std::string& output, std::string& baseline, double& threshold );
+void        printUsage( void );
+std::string getKey( int population_size, int number_of_dimensions, std::string noise, int mean_fitness, int generations );
+void        runScenario( bench_scenario& scenario, unsigned long int seed, int generations );
+void        loadBaseline( std::string baseline, std::map<std::string, std::pair<double, double> >& reference );
+bool        compareToBaseline( std::vector<bench_scenario>& scenarios, int generations, std::map<std::string, std::pair<double, double> >& reference, std::string baseline, double threshold );
+
+
+/**
+ * \brief    Main function
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int main( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read parameters                 */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  unsigned long int seed                = 1;
+  int               generations         = 10;
+  int               max_population_size = 100000;
+  int               max_dimensions      = 50;
+  std::string       output              = "bench_simulation.txt";
+  std::string       baseline            = "";
+  double            threshold           = 10.0;
+  readArgs(argc, argv, seed, generations, max_population_size, max_dimensions, output, baseline, threshold);
+  
+  /* The baseline is loaded before the output is truncated, as both can be the same file */
+  std::map<std::string, std::pair<double, double> > reference;
+  if (baseline != "")
+  {
+    loadBaseline(baseline, reference);
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Build the scenario matrix       */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::vector<bench_scenario> scenarios;
+  for (int i = 0; i < NUMBER_OF_POPULATION_SIZES && POPULATION_SIZES[i] <= max_population_size; i++)
+  {
+    for (int j = 0; j < NUMBER_OF_DIMENSIONS && DIMENSIONS[j] <= max_dimensions; j++)
+    {
+      for (int noise = NONE; noise <= FULL; noise++)
+      {
+        for (int mean_fitness = 0; mean_fitness <= 1; mean_fitness++)
+        {
+          bench_scenario scenario;
+          scenario.population_size      = POPULATION_SIZES[i];
+          scenario.number_of_dimensions = DIMENSIONS[j];
+          scenario.noise_type           = (type_of_noise)noise;
+          scenario.mean_fitness         = (mean_fitness == 1);
+          scenario.time                 = 0.0;
+          scenario.generations_per_s    = 0.0;
+          scenario.peak_rss             = 0.0;
+          scenarios.push_back(scenario);
+        }
+      }
+    }
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Run the scenarios               */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::ofstream file(output.c_str(), std::ios::out | std::ios::trunc);
+  if (!file)
+  {
+    printf("Error: impossible to open file %s. Exit.\n", output.c_str());
+    exit(EXIT_FAILURE);
+  }
+  file << "N n noise mean_fitness generations time generations_per_s peak_rss_MB\n";
+  for (size_t i = 0; i < scenarios.size(); i++)
+  {
+    runScenario(scenarios[i], seed, generations);
+    file << scenarios[i].population_size << " ";
+    file << scenarios[i].number_of_dimensions << " ";
+    file << NOISE_NAMES[scenarios[i].noise_type] << " ";
+    file << scenarios[i].mean_fitness << " ";
+    file << generations << " ";
+    file << scenarios[i].time << " ";
+    file << scenarios[i].generations_per_s << " ";
+    file << scenarios[i].peak_rss << "\n";
+    file.flush();
+    std::cout << "N=" << scenarios[i].population_size << " n=" << scenarios[i].number_of_dimensions << " " << NOISE_NAMES[scenarios[i].noise_type] << (scenarios[i].mean_fitness ? " mean fitness" : "") << ": " << scenarios[i].generations_per_s << " generations/s, " << scenarios[i].peak_rss << " MB\n";
+  }
+  file.close();
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Compare to the baseline         */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (baseline != "" && !compareToBaseline(scenarios, generations, reference, baseline, threshold))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+/**
+ * \brief    Read command line arguments
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \param    unsigned long int& seed
+ * \param    int& generations
+ * \param    int& max_population_size
+ * \param    int& max_dimensions
+ * \param    std::string& output
+ * \param    std::string& baseline
+ * \param    double& threshold
+ * \return   \e void
+ */
+void readArgs( int argc, char const** argv, unsigned long int& seed, int& generations, int& max_population_size, int& max_dimensions, std::string& output, std::string& baseline, double& threshold )
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+    {
+      printUsage();
+      exit(EXIT_SUCCESS);
+    }
+    else if (i+1 == argc)
+    {
+      std::cout << "Error: command line parameter value is missing.\n";
+      exit(EXIT_FAILURE);
+    }
+    else if (strcmp(argv[i], "-seed") == 0 || strcmp(argv[i], "--seed") == 0)
+    {
+      seed = (unsigned long int)atol(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-g") == 0 || strcmp(argv[i], "--generations") == 0)
+    {
+      generations = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-maxpopsize") == 0 || strcmp(argv[i], "--max-population-size") == 0)
+    {
+      max_population_size = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-maxnbdim") == 0 || strcmp(argv[i], "--max-number-of-dimensions") == 0)
+    {
+      max_dimensions = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-output") == 0 || strcmp(argv[i], "--output") == 0)
+    {
+      output = argv[++i];
+    }
+    else if (strcmp(argv[i], "-baseline") == 0 || strcmp(argv[i], "--baseline") == 0)
+    {
+      baseline = argv[++i];
+    }
+    else if (strcmp(argv[i], "-threshold") == 0 || strcmp(argv[i], "--threshold") == 0)
+    {
+      threshold = atof(argv[++i]);
+    }
+    else
+    {
+      printf("Error: unknown option %s (see -h or --help). Exit.\n", argv[i]);
+      exit(EXIT_FAILURE);
+    }
+  }
+  if (seed == 0 || generations <= 0 || threshold < 0.0)
+  {
+    printf("Error: the seed and the number of generations must be positive, and the threshold cannot be negative. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * \brief    Print usage
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printUsage( void )
+{
+  std::cout << "Usage: bench_simulation -h or --help\n";
+  std::cout << "   or: bench_simulation [options]\n";
+  std::cout << "Runs the evolution of N in {100, 1000, 10000, 100000} individuals, for n in {1, 10, 50} and each type of noise,\n";
+  std::cout << "with and without mean fitness, and records the wall time, the throughput and the peak memory of each scenario\n";
+  std::cout << "Options are:\n";
+  std::cout << "  -h, --help\n";
+  std::cout << "        print this help, then exit\n";
+  std::cout << "  -seed, --seed\n";
+  std::cout << "        specify the prng seed (1 by default)\n";
+  std::cout << "  -g, --generations\n";
+  std::cout << "        specify the number of generations of each scenario (10 by default)\n";
+  std::cout << "  -maxpopsize, --max-population-size\n";
+  std::cout << "        skip scenarios with more individuals (100000 by default)\n";
+  std::cout << "  -maxnbdim, --max-number-of-dimensions\n";
+  std::cout << "        skip scenarios with more dimensions (50 by default)\n";
+  std::cout << "  -output, --output\n";
+  std::cout << "        specify the results file (bench_simulation.txt by default)\n";
+  std::cout << "  -baseline, --baseline\n";
+  std::cout << "        specify a results file of a previous run, to compare with\n";
+  std::cout << "  -threshold, --threshold\n";
+  std::cout << "        specify the tolerated loss of throughput or gain of memory, in percent (10 by default)\n";
+}
+
+/**
+ * \brief    Get the key identifying a scenario
+ * \details  --
+ * \param    int population_size
+ * \param    int number_of_dimensions
+ * \param    std::string noise
+ * \param    int mean_fitness
+ * \param    int generations
+ * \return   \e std::string
+ */
+std::string getKey( int population_size, int number_of_dimensions, std::string noise, int mean_fitness, int generations )
+{
+  std::stringstream key;
+  key << population_size << " " << number_of_dimensions << " " << noise << " " << mean_fitness << " " << generations;
+  return key.str();
+}
+
+/**
+ * \brief    Run a scenario
+ * \details  The scenario runs in a child process, so that its peak memory is measured independently of the other ones.
+ *           Only the evolution is timed (the initial population is not stabilized), and no file is written
+ * \param    bench_scenario& scenario
+ * \param    unsigned long int seed
+ * \param    int generations
+ * \return   \e void
+ */
+void runScenario( bench_scenario& scenario, unsigned long int seed, int generations )
+{
+  int channel[2];
+  if (pipe(channel) != 0)
+  {
+    printf("Error: impossible to create a pipe. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  pid_t pid = fork();
+  if (pid < 0)
+  {
+    printf("Error: impossible to create a child process. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Child: run the simulation       */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (pid == 0)
+  {
+    close(channel[0]);
+    Parameters* parameters = createTestParameters(seed, generations, scenario.number_of_dimensions, scenario.population_size, scenario.noise_type);
+    parameters->set_mean_fitness(scenario.mean_fitness);
+    Simulation* simulation = new Simulation(parameters);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    simulation->run(generations);
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+    ssize_t written = write(channel[1], &time, sizeof(time));
+    close(channel[1]);
+    _exit(written == sizeof(time) ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Parent: collect the measures    */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  close(channel[1]);
+  double  time = 0.0;
+  ssize_t read_size = read(channel[0], &time, sizeof(time));
+  close(channel[0]);
+  int           status = 0;
+  struct rusage usage;
+  if (wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS || read_size != sizeof(time))
+  {
+    printf("Error: scenario N=%d n=%d %s failed. Exit.\n", scenario.population_size, scenario.number_of_dimensions, NOISE_NAMES[scenario.noise_type]);
+    exit(EXIT_FAILURE);
+  }
+  scenario.time              = time;
+  scenario.generations_per_s = (time > 0.0 ? generations/time : 0.0);
+  scenario.peak_rss          = usage.ru_maxrss/1024.0;
+}
+
+/**
+ * \brief    Load a baseline
+ * \details  The baseline is a previous output of bench_simulation. Throughput and peak memory are indexed by scenario key
+ * \param    std::string baseline
+ * \param    std::map<std::string, std::pair<double, double> >& reference
+ * \return   \e void
+ */
+void loadBaseline( std::string baseline, std::map<std::string, std::pair<double, double> >& reference )
+{
+  std::ifstream file(baseline.c_str(), std::ios::in);
+  if (!file)
+  {
+    printf("Error: impossible to open baseline file %s. Exit.\n", baseline.c_str());
+    exit(EXIT_FAILURE);
+  }
+  std::string line;
+  std::getline(file, line);
+  while (std::getline(file, line))
+  {
+    std::stringstream flux(line);
+    int         population_size      = 0;
+    int         number_of_dimensions = 0;
+    std::string noise                = "";
+    int         mean_fitness         = 0;
+    int         baseline_generations = 0;
+    double      time                 = 0.0;
+    double      generations_per_s    = 0.0;
+    double      peak_rss             = 0.0;
+    if (flux >> population_size >> number_of_dimensions >> noise >> mean_fitness >> baseline_generations >> time >> generations_per_s >> peak_rss)
+    {
+      reference[getKey(population_size, number_of_dimensions, noise, mean_fitness, baseline_generations)] = std::make_pair(generations_per_s, peak_rss);
+    }
+  }
+  file.close();
+}
+
+/**
+ * \brief    Compare the scenarios to a baseline
+ * \details  A scenario regresses when its throughput is lower, or its peak memory higher, than in the baseline by more
+ *           than threshold percent. Scenarios missing from the baseline are reported but not compared
+ * \param    std::vector<bench_scenario>& scenarios
+ * \param    int generations
+ * \param    std::map<std::string, std::pair<double, double> >& reference
+ * \param    std::string baseline
+ * \param    double threshold
+ * \return   \e bool (false if a scenario regressed)
+ */
+bool compareToBaseline( std::vector<bench_scenario>& scenarios, int generations, std::map<std::string, std::pair<double, double> >& reference, std::string baseline, double threshold )
+{
+  int number_of_regressions = 0;
+  std::cout << "Comparison to " << baseline << " (threshold " << threshold << "%):\n";
+  for (size_t i = 0; i < scenarios.size(); i++)
+  {
+    std::string key = getKey(scenarios[i].population_size, scenarios[i].number_of_dimensions, NOISE_NAMES[scenarios[i].noise_type], scenarios[i].mean_fitness, generations);
+    std::cout << "  " << key << ": ";
+    if (reference.find(key) == reference.end())
+    {
+      std::cout << "not in the baseline\n";
+      continue;
+    }
+    double speed_ratio  = (reference[key].first > 0.0 ? scenarios[i].generations_per_s/reference[key].first : 1.0);
+    double memory_ratio = (reference[key].second > 0.0 ? scenarios[i].peak_rss/reference[key].second : 1.0);
+    bool   regression   = (speed_ratio < 1.0-threshold/100.0 || memory_ratio > 1.0+threshold/100.0);
+    std::cout << "throughput x" << speed_ratio << ", memory x" << memory_ratio << (regression ? "  REGRESSION" : "") << "\n";
+    number_of_regressions += (regression ? 1 : 0);
+  }
+  std::cout << number_of_regressions << " regression(s).\n";
+  return (number_of_regressions == 0);
+}
@@ -0,0 +1,104 @@
+
+/**
+ * \file      AllocationCounter.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     AllocationCounter class definition
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "AllocationCounter.h"
+
+/* Per-thread counters. The initial-exec model keeps them in static TLS, so that reading them never allocates */
+static __thread unsigned long long int allocations     __attribute__((tls_model("initial-exec"))) = 0;
+static __thread unsigned long long int allocated_bytes __attribute__((tls_model("initial-exec"))) = 0;
+
+#if defined(__GLIBC__) && !defined(WITHOUT_COUNTING_ALLOCATOR)
+extern "C" void* __libc_malloc( size_t size );
+extern "C" void* __libc_calloc( size_t number, size_t size );
+extern "C" void* __libc_realloc( void* pointer, size_t size );
+
+/* Counting allocator: replaces the allocation functions of the C library, and forwards to them */
+extern "C" void* malloc( size_t size )
+{
+  allocations++;
+  allocated_bytes += size;
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc( size_t number, size_t size )
+{
+  allocations++;
+  allocated_bytes += number*size;
+  return __libc_calloc(number, size);
+}
+
+extern "C" void* realloc( void* pointer, size_t size )
+{
+  allocations++;
+  allocated_bytes += size;
+  return __libc_realloc(pointer, size);
+}
+#endif
+
+
+/*----------------------------
+ * GETTERS
+ *----------------------------*/
+
+/**
+ * \brief    Check if allocations are counted
+ * \details  --
+ * \param    void
+ * \return   \e bool
+ */
+bool AllocationCounter::is_enabled( void )
+{
+#if defined(__GLIBC__) && !defined(WITHOUT_COUNTING_ALLOCATOR)
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * \brief    Get the number of heap allocations of the calling thread
+ * \details  --
+ * \param    void
+ * \return   \e unsigned long long int
+ */
+unsigned long long int AllocationCounter::get_allocations( void )
+{
+  return allocations;
+}
+
+/**
+ * \brief    Get the number of bytes allocated by the calling thread
+ * \details  Freed memory is not deducted
+ * \param    void
+ * \return   \e unsigned long long int
+ */
+unsigned long long int AllocationCounter::get_allocated_bytes( void )
+{
+  return allocated_bytes;
+}
@@ -0,0 +1,74 @@
+
+/**
+ * \file      AllocationCounter.h
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     AllocationCounter class declaration
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#ifndef __SigmaFGM__AllocationCounter__
+#define __SigmaFGM__AllocationCounter__
+
+#include <iostream>
+#include <cstdlib>
+
+
+/**
+ * \brief   Heap allocation counter
+ * \details Counts the heap allocations of the calling thread (malloc, calloc and realloc, and thus GSL vectors and matrices,
+ *          and operator new). The counting allocator is only linked in executables using this class (benchmarks, tests, or
+ *          builds WITH_INSTRUMENTATION), and requires glibc. It is left out of the shared library (WITHOUT_COUNTING_ALLOCATOR),
+ *          where allocations are not counted
+ */
+class AllocationCounter
+{
+  
+public:
+  
+  /*----------------------------
+   * CONSTRUCTORS
+   *----------------------------*/
+  AllocationCounter( void ) = delete;
+  AllocationCounter( const AllocationCounter& counter ) = delete;
+  
+  /*----------------------------
+   * DESTRUCTORS
+   *----------------------------*/
+  ~AllocationCounter( void ) = delete;
+  
+  /*----------------------------
+   * GETTERS
+   *----------------------------*/
+  static bool                   is_enabled( void );
+  static unsigned long long int get_allocations( void );
+  static unsigned long long int get_allocated_bytes( void );
+  
+  /*----------------------------
+   * SETTERS
+   *----------------------------*/
+  AllocationCounter& operator=(const AllocationCounter&) = delete;
+};
+
+
+#endif /* defined(__SigmaFGM__AllocationCounter__) */
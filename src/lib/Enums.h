@@ -46,26 +46,81 @@ enum type_of_noise
 /******************************************************************************************/
 
 /**
- * \brief   Node class
- * \details Defines the class of a node in the tree (master root, root or normal).
+ * \brief   Simulation phase
+ * \details Defines the current phase of the simulation (saved in checkpoints).
  */
-enum node_class
+enum simulation_phase
 {
-  MASTER_ROOT = 1, /*!< The node is the master root */
-  ROOT        = 2, /*!< The node is a root          */
-  NORMAL      = 3  /*!< The node is normal          */
+  STABILIZATION = 1, /*!< The population is stabilized around the initial optimum */
+  EVOLUTION     = 2  /*!< The population evolves towards the optimum             */
 };
 
 /******************************************************************************************/
 
 /**
- * \brief   Node state
- * \details Defines the state of a node in the tree, depending on individual status (dead or alive).
+ * \brief   Telemetry phase
+ * \details Defines the parts of a generation timed by the telemetry
  */
-enum node_state
+enum telemetry_phase
 {
-  DEAD  = 1, /*!< The individual is dead  */
-  ALIVE = 2  /*!< The individual is alive */
+  RESAMPLING = 0, /*!< Parent draws, offspring copies and lineage recording */
+  MUTATION   = 1, /*!< Offspring mutations                                  */
+  PHENOTYPE  = 2, /*!< Phenotype builds                                     */
+  FITNESS    = 3, /*!< Fitness computations                                 */
+  STATISTICS = 4, /*!< Population statistics                                */
+  OUTPUT     = 5  /*!< Statistic files, snapshots and checkpoints           */
+};
+
+/******************************************************************************************/
+
+/**
+ * \brief   Instrumented zone
+ * \details Defines the scopes timed, and the events counted, by the instrumentation (see Instrumentation.h)
+ */
+enum trace_zone
+{
+  TRACE_REPRODUCTION     = 0,  /*!< Population generation steps                  */
+  TRACE_RESAMPLING       = 1,  /*!< Multinomial draw of the parents              */
+  TRACE_MUTATION         = 2,  /*!< Individual::mutate                           */
+  TRACE_PHENOTYPE        = 3,  /*!< Individual::build_phenotype                  */
+  TRACE_SIGMA            = 4,  /*!< Individual::build_Sigma                      */
+  TRACE_CHOLESKY         = 5,  /*!< Individual::Cholesky_decomposition           */
+  TRACE_DRAW_Z           = 6,  /*!< Individual::draw_z                           */
+  TRACE_FITNESS          = 7,  /*!< Individual::compute_fitness                  */
+  TRACE_MEAN_FITNESS     = 8,  /*!< Individual::compute_mean_fitness             */
+  TRACE_STATISTICS       = 9,  /*!< Statistics::compute_statistics               */
+  TRACE_WRITE_STATISTICS = 10, /*!< Statistics::write_statistics                 */
+  TRACE_WRITE_SNAPSHOT   = 11, /*!< Snapshot::write_snapshot                     */
+  TRACE_WRITE_CHECKPOINT = 12, /*!< Simulation::save                             */
+  TRACE_MU_MUTATIONS     = 13, /*!< Number of mu mutations (counter)             */
+  TRACE_SIGMA_MUTATIONS  = 14, /*!< Number of sigma mutations (counter)          */
+  TRACE_THETA_MUTATIONS  = 15, /*!< Number of theta mutations (counter)          */
+  TRACE_GENERATION       = 16  /*!< Whole generation                             */
+};
+
+/**
+ * \brief   Hardware counter
+ * \details Events counted by the hardware counters (see HardwareCounters.h)
+ */
+enum hardware_counter
+{
+  HW_CYCLES        = 0, /*!< CPU cycles                        */
+  HW_INSTRUCTIONS  = 1, /*!< Retired instructions              */
+  HW_L1D_MISSES    = 2, /*!< L1 data cache read misses         */
+  HW_LLC_MISSES    = 3, /*!< Last level cache misses           */
+  HW_BRANCH_MISSES = 4  /*!< Mispredicted branches             */
+};
+
+/******************************************************************************************/
+
+/**
+ * \brief   Generation engine
+ * \details Defines how the offspring of a generation are computed. Both engines produce identical populations and statistics
+ */
+enum type_of_engine
+{
+  REFERENCE = 0, /*!< Whole population reproduction, then statistics           */
+  TILED     = 1  /*!< Offspring computed by cache-sized tiles, fused statistics */
 };
 
 
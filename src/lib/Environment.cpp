@@ -55,6 +55,28 @@ Environment::Environment( Parameters* parameters )
   gsl_vector_set_zero(_z_opt);
 }
 
+/**
+ * \brief    Constructor from backup file
+ * \details  --
+ * \param    Parameters* parameters
+ * \param    std::ifstream& backup_file
+ * \return   \e void
+ */
+Environment::Environment( Parameters* parameters, std::ifstream& backup_file )
+{
+  assert(parameters != NULL);
+  
+  /*----------------------------------------------- PARAMETERS */
+  
+  _parameters = parameters;
+  _prng       = _parameters->get_prng();
+  
+  /*----------------------------------------------- ENVIRONMENT */
+  
+  _z_opt = gsl_vector_alloc(_parameters->get_number_of_dimensions());
+  backup_file.read((char*)_z_opt->data, sizeof(double)*_z_opt->size);
+}
+
 /*----------------------------
  * DESTRUCTORS
  *----------------------------*/
@@ -107,6 +129,17 @@ void Environment::normal_environment( void )
   gsl_vector_set_zero(_z_opt);
 }
 
+/**
+ * \brief    Save the environment in a backup file
+ * \details  --
+ * \param    std::ofstream& backup_file
+ * \return   \e void
+ */
+void Environment::save( std::ofstream& backup_file ) const
+{
+  backup_file.write((char*)_z_opt->data, sizeof(double)*_z_opt->size);
+}
+
 /*----------------------------
  * PROTECTED METHODS
  *----------------------------*/
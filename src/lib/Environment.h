@@ -31,6 +31,7 @@
 #define __SigmaFGM__Environment__
 
 #include <iostream>
+#include <fstream>
 #include <assert.h>
 #include <gsl/gsl_vector.h>
 
@@ -50,6 +51,7 @@ public:
    *----------------------------*/
   Environment( void ) = delete;
   Environment( Parameters* parameters );
+  Environment( Parameters* parameters, std::ifstream& backup_file );
   Environment( const Environment& environment ) = delete;
   
   /*----------------------------
@@ -73,6 +75,7 @@ public:
    *----------------------------*/
   void stabilizing_environment( void );
   void normal_environment( void );
+  void save( std::ofstream& backup_file ) const;
   
   /*----------------------------
    * PUBLIC ATTRIBUTES
@@ -0,0 +1,187 @@
+
+/**
+ * \file      HardwareCounters.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     HardwareCounters class definition
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "HardwareCounters.h"
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+/**
+ * \brief   Event type and configuration of each counter, in the order of hardware_counter
+ * \details --
+ */
+static const unsigned int HW_COUNTER_TYPES[HW_COUNTERS] =
+{
+  PERF_TYPE_HARDWARE,
+  PERF_TYPE_HARDWARE,
+  PERF_TYPE_HW_CACHE,
+  PERF_TYPE_HARDWARE,
+  PERF_TYPE_HARDWARE
+};
+static const unsigned long long int HW_COUNTER_CONFIGS[HW_COUNTERS] =
+{
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+  PERF_COUNT_HW_CACHE_MISSES,
+  PERF_COUNT_HW_BRANCH_MISSES
+};
+#endif
+
+
+/*----------------------------
+ * CONSTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Default constructor
+ * \details  Counters are not open until open() is called
+ * \param    void
+ * \return   \e void
+ */
+HardwareCounters::HardwareCounters( void )
+{
+  _leader             = -1;
+  _number_of_counters = 0;
+  for (int counter = 0; counter < HW_COUNTERS; counter++)
+  {
+    _descriptors[counter] = -1;
+  }
+}
+
+/*----------------------------
+ * DESTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Destructor
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+HardwareCounters::~HardwareCounters( void )
+{
+  close();
+}
+
+/*----------------------------
+ * PUBLIC METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Open the counters of the calling thread
+ * \details  Previously open counters are closed first. The cycle counter leads the group: if it cannot be opened, no
+ *           counter is available
+ * \param    void
+ * \return   \e void
+ */
+void HardwareCounters::open( void )
+{
+  close();
+#ifdef __linux__
+  for (int counter = 0; counter < HW_COUNTERS; counter++)
+  {
+    struct perf_event_attr attributes;
+    memset(&attributes, 0, sizeof(struct perf_event_attr));
+    attributes.size           = sizeof(struct perf_event_attr);
+    attributes.type           = HW_COUNTER_TYPES[counter];
+    attributes.config         = HW_COUNTER_CONFIGS[counter];
+    attributes.disabled       = (_leader < 0 ? 1 : 0);
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv     = 1;
+    attributes.read_format    = PERF_FORMAT_GROUP;
+    _descriptors[counter]     = (int)syscall(__NR_perf_event_open, &attributes, 0, -1, _leader, 0);
+    if (_descriptors[counter] < 0 && _leader < 0)
+    {
+      return;
+    }
+    if (_descriptors[counter] >= 0)
+    {
+      _leader = (_leader < 0 ? _descriptors[counter] : _leader);
+      _number_of_counters++;
+    }
+  }
+  ioctl(_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+/**
+ * \brief    Close the counters
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void HardwareCounters::close( void )
+{
+#ifdef __linux__
+  for (int counter = HW_COUNTERS-1; counter >= 0; counter--)
+  {
+    if (_descriptors[counter] >= 0)
+    {
+      ::close(_descriptors[counter]);
+    }
+  }
+#endif
+  _leader             = -1;
+  _number_of_counters = 0;
+  for (int counter = 0; counter < HW_COUNTERS; counter++)
+  {
+    _descriptors[counter] = -1;
+  }
+}
+
+/**
+ * \brief    Read the current value of every counter
+ * \details  The group is read at once. Unavailable counters read as zero
+ * \param    unsigned long long int* values
+ * \return   \e void
+ */
+void HardwareCounters::sample( unsigned long long int* values ) const
+{
+  memset(values, 0, sizeof(unsigned long long int)*HW_COUNTERS);
+#ifdef __linux__
+  unsigned long long int buffer[1+HW_COUNTERS];
+  if (_leader < 0 || ::read(_leader, buffer, sizeof(buffer)) < (ssize_t)(sizeof(unsigned long long int)*(1+_number_of_counters)))
+  {
+    return;
+  }
+  int position = 1;
+  for (int counter = 0; counter < HW_COUNTERS; counter++)
+  {
+    if (_descriptors[counter] >= 0)
+    {
+      values[counter] = buffer[position];
+      position++;
+    }
+  }
+#endif
+}
@@ -0,0 +1,131 @@
+
+/**
+ * \file      HardwareCounters.h
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     HardwareCounters class declaration
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#ifndef __SigmaFGM__HardwareCounters__
+#define __SigmaFGM__HardwareCounters__
+
+#include <iostream>
+#include <cstring>
+#include <assert.h>
+
+#include "Macros.h"
+#include "Enums.h"
+
+
+/**
+ * \brief   Hardware performance counters
+ * \details Counts the cycles, instructions, L1 data cache misses, last level cache misses and branch misses of the calling
+ *          thread (user space only), through a perf_event_open group on Linux. Counters the processor (or the kernel
+ *          settings, see /proc/sys/kernel/perf_event_paranoid) do not provide read as zero
+ */
+class HardwareCounters
+{
+  
+public:
+  
+  /*----------------------------
+   * CONSTRUCTORS
+   *----------------------------*/
+  HardwareCounters( void );
+  HardwareCounters( const HardwareCounters& counters ) = delete;
+  
+  /*----------------------------
+   * DESTRUCTORS
+   *----------------------------*/
+  ~HardwareCounters( void );
+  
+  /*----------------------------
+   * GETTERS
+   *----------------------------*/
+  inline bool is_available( void ) const;
+  inline bool is_available( hardware_counter counter ) const;
+  
+  /*----------------------------
+   * SETTERS
+   *----------------------------*/
+  HardwareCounters& operator=(const HardwareCounters&) = delete;
+  
+  /*----------------------------
+   * PUBLIC METHODS
+   *----------------------------*/
+  void open( void );
+  void close( void );
+  void sample( unsigned long long int* values ) const;
+  
+  /*----------------------------
+   * PUBLIC ATTRIBUTES
+   *----------------------------*/
+  
+protected:
+  
+  /*----------------------------
+   * PROTECTED METHODS
+   *----------------------------*/
+  
+  /*----------------------------
+   * PROTECTED ATTRIBUTES
+   *----------------------------*/
+  int _leader;                   /*!< Group leader descriptor (-1 if unavailable)    */
+  int _descriptors[HW_COUNTERS]; /*!< Descriptor of each counter (-1 if unavailable) */
+  int _number_of_counters;       /*!< Number of counters in the group                */
+};
+
+
+/*----------------------------
+ * GETTERS
+ *----------------------------*/
+
+/**
+ * \brief    Check if hardware counters are open
+ * \details  --
+ * \param    void
+ * \return   \e bool
+ */
+inline bool HardwareCounters::is_available( void ) const
+{
+  return _leader >= 0;
+}
+
+/**
+ * \brief    Check if a hardware counter is open
+ * \details  --
+ * \param    hardware_counter counter
+ * \return   \e bool
+ */
+inline bool HardwareCounters::is_available( hardware_counter counter ) const
+{
+  return _descriptors[counter] >= 0;
+}
+
+/*----------------------------
+ * SETTERS
+ *----------------------------*/
+
+
+#endif /* defined(__SigmaFGM__HardwareCounters__) */
@@ -121,11 +121,11 @@ Individual::Individual( Prng* prng, int n, double mu_init, double sigma_init, do
   
   /*----------------------------------------------- MAPPING PROPERTIES */
   
-  _phenotype_is_built     = false;
-  _max_Sigma_eigenvector  = NULL;
-  _max_Sigma_eigenvalue   = 0.0;
-  _max_Sigma_contribution = 0.0;
-  _max_dot_product        = 0.0;
+  _phenotype_is_built       = false;
+  _diagnostics_are_computed = true;
+  _max_Sigma_eigenvalue     = 0.0;
+  _max_Sigma_contribution   = 0.0;
+  _max_dot_product          = 0.0;
   
   /*----------------------------------------------- MUTATIONS */
   
@@ -134,6 +134,84 @@ Individual::Individual( Prng* prng, int n, double mu_init, double sigma_init, do
   _r_theta = 0.0;
 }
 
+/**
+ * \brief    Constructor from backup file
+ * \details  The Cholesky matrix is restored with the genotype, so that z can be drawn again without rebuilding the mapping
+ * \param    Prng* prng
+ * \param    gsl_vector* z_opt
+ * \param    std::ifstream& backup_file
+ * \return   \e void
+ */
+Individual::Individual( Prng* prng, gsl_vector* z_opt, std::ifstream& backup_file )
+{
+  /*----------------------------------------------- PARAMETERS */
+  
+  int noise_type = 0;
+  _prng          = prng;
+  _z_opt         = z_opt;
+  backup_file.read((char*)&_n, sizeof(_n));
+  backup_file.read((char*)&noise_type, sizeof(noise_type));
+  _noise_type = (type_of_noise)noise_type;
+  
+  /*----------------------------------------------- VARIABLES */
+  
+  backup_file.read((char*)&_identifier, sizeof(_identifier));
+  backup_file.read((char*)&_generation, sizeof(_generation));
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Load genotype              */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  _mu = gsl_vector_alloc(_n);
+  backup_file.read((char*)_mu->data, sizeof(double)*_n);
+  _sigma = NULL;
+  if (_noise_type != NONE)
+  {
+    _sigma = gsl_vector_alloc(_n);
+    backup_file.read((char*)_sigma->data, sizeof(double)*_n);
+  }
+  _theta = NULL;
+  if (_n > 1 && _noise_type == FULL)
+  {
+    _theta = gsl_vector_alloc(_n*(_n-1)/2);
+    backup_file.read((char*)_theta->data, sizeof(double)*_n*(_n-1)/2);
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Load the mapping           */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  _Sigma    = NULL;
+  _Cholesky = NULL;
+  backup_file.read((char*)&_phenotype_is_built, sizeof(_phenotype_is_built));
+  if (_phenotype_is_built && _noise_type != NONE)
+  {
+    _Cholesky = gsl_matrix_alloc(_n, _n);
+    backup_file.read((char*)_Cholesky->data, sizeof(double)*_n*_n);
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Load phenotype and fitness */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  _z = gsl_vector_alloc(_n);
+  backup_file.read((char*)_z->data, sizeof(double)*_n);
+  backup_file.read((char*)&_dmu, sizeof(_dmu));
+  backup_file.read((char*)&_dz, sizeof(_dz));
+  backup_file.read((char*)&_Wmu, sizeof(_Wmu));
+  backup_file.read((char*)&_Wz, sizeof(_Wz));
+  
+  /*----------------------------------------------- MAPPING PROPERTIES */
+  
+  _diagnostics_are_computed = true;
+  backup_file.read((char*)&_max_Sigma_eigenvalue, sizeof(_max_Sigma_eigenvalue));
+  backup_file.read((char*)&_max_Sigma_contribution, sizeof(_max_Sigma_contribution));
+  backup_file.read((char*)&_max_dot_product, sizeof(_max_dot_product));
+  
+  /*----------------------------------------------- MUTATIONS */
+  
+  backup_file.read((char*)&_r_mu, sizeof(_r_mu));
+  backup_file.read((char*)&_r_sigma, sizeof(_r_sigma));
+  backup_file.read((char*)&_r_theta, sizeof(_r_theta));
+}
+
 /**
  * \brief    Copy constructor
  * \details  --
@@ -202,11 +280,11 @@ Individual::Individual( const Individual& individual )
   
   /*----------------------------------------------- MAPPING PROPERTIES */
   
-  _phenotype_is_built     = false;
-  _max_Sigma_eigenvector  = NULL;
-  _max_Sigma_eigenvalue   = individual._max_Sigma_eigenvalue;
-  _max_Sigma_contribution = individual._max_Sigma_contribution;
-  _max_dot_product        = individual._max_dot_product;
+  _phenotype_is_built       = false;
+  _diagnostics_are_computed = individual._diagnostics_are_computed;
+  _max_Sigma_eigenvalue     = individual._max_Sigma_eigenvalue;
+  _max_Sigma_contribution   = individual._max_Sigma_contribution;
+  _max_dot_product          = individual._max_dot_product;
   
   /*----------------------------------------------- MUTATIONS */
   
@@ -239,8 +317,6 @@ Individual::~Individual( void )
     _Sigma = NULL;
     gsl_matrix_free(_Cholesky);
     _Cholesky = NULL;
-    gsl_vector_free(_max_Sigma_eigenvector);
-    _max_Sigma_eigenvector = NULL;
     if (_n > 1 && _noise_type == FULL)
     {
       gsl_vector_free(_theta);
@@ -257,7 +333,8 @@ Individual::~Individual( void )
 
 /**
  * \brief    Mutate the individual genotype
- * \details  --
+ * \details  Mutation sizes are accumulated while the genotype is mutated, from the actual step of each value (after the
+ *           reflection of sigma at zero)
  * \param    double m_mu
  * \param    double m_sigma
  * \param    double m_theta
@@ -268,110 +345,79 @@ Individual::~Individual( void )
  */
 void Individual::mutate( double m_mu, double m_sigma, double m_theta, double s_mu, double s_sigma, double s_theta )
 {
-  gsl_vector* previous_mu    = NULL;
-  gsl_vector* previous_sigma = NULL;
-  gsl_vector* previous_theta = NULL;
-  
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 1) Save current genotype  */
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  previous_mu = gsl_vector_alloc(_n);
-  gsl_vector_memcpy(previous_mu, _mu);
-  if (_noise_type != NONE)
-  {
-    previous_sigma = gsl_vector_alloc(_n);
-    gsl_vector_memcpy(previous_sigma, _sigma);
-    if (_n > 1 && _noise_type == FULL)
-    {
-      previous_theta = gsl_vector_alloc(_n*(_n-1)/2);
-      gsl_vector_memcpy(previous_theta, _theta);
-    }
-  }
+  INSTRUMENT_SCOPE(TRACE_MUTATION);
+  _r_mu    = 0.0;
+  _r_sigma = 0.0;
+  _r_theta = 0.0;
   
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 2) Mutate X vector        */
+  /* 1) Mutate X vector        */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   if (_prng->uniform() < m_mu)
   {
     for (int i = 0; i < _n; i++)
     {
-      gsl_vector_set(_mu, i, gsl_vector_get(_mu, i)+_prng->gaussian(0.0, s_mu));
+      double previous  = gsl_vector_get(_mu, i);
+      double mu        = previous+_prng->gaussian(0.0, s_mu);
+      _r_mu           += (mu-previous)*(mu-previous);
+      gsl_vector_set(_mu, i, mu);
     }
     _phenotype_is_built = false;
+    INSTRUMENT_COUNT(TRACE_MU_MUTATIONS);
   }
   
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 3) Mutate Ve vector       */
+  /* 2) Mutate Ve vector       */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   if (_noise_type != NONE && _prng->uniform() < m_sigma)
   {
     if (_noise_type == ISOTROPIC)
     {
-      double new_sigma = fabs(gsl_vector_get(_sigma, 0)+_prng->gaussian(0.0, s_sigma));
+      double previous  = gsl_vector_get(_sigma, 0);
+      double new_sigma = fabs(previous+_prng->gaussian(0.0, s_sigma));
       gsl_vector_set_all(_sigma, new_sigma);
+      /*** Every dimension moves by the same step ***/
+      for (int i = 0; i < _n; i++)
+      {
+        _r_sigma += (new_sigma-previous)*(new_sigma-previous);
+      }
     }
     else if (_noise_type == UNCORRELATED || _noise_type == FULL)
     {
       for (int i = 0; i < _n; i++)
       {
-        gsl_vector_set(_sigma, i, fabs(gsl_vector_get(_sigma, i)+_prng->gaussian(0.0, s_sigma)));
+        double previous  = gsl_vector_get(_sigma, i);
+        double sigma     = fabs(previous+_prng->gaussian(0.0, s_sigma));
+        _r_sigma        += (sigma-previous)*(sigma-previous);
+        gsl_vector_set(_sigma, i, sigma);
       }
     }
     _phenotype_is_built = false;
+    INSTRUMENT_COUNT(TRACE_SIGMA_MUTATIONS);
   }
   
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 4) Mutate Theta vector    */
+  /* 3) Mutate Theta vector    */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   if (_n > 1 && _noise_type == FULL && _prng->uniform() < m_theta)
   {
     for (int i = 0; i < _n*(_n-1)/2; i++)
     {
-      gsl_vector_set(_theta, i, gsl_vector_get(_theta, i)+_prng->gaussian(0.0, s_theta));
+      double previous  = gsl_vector_get(_theta, i);
+      double theta     = previous+_prng->gaussian(0.0, s_theta);
+      _r_theta        += (theta-previous)*(theta-previous);
+      gsl_vector_set(_theta, i, theta);
     }
+    INSTRUMENT_COUNT(TRACE_THETA_MUTATIONS);
   }
   _phenotype_is_built = false;
   
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 5) Compute mutation sizes */
+  /* 4) Compute mutation sizes */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  _r_mu    = 0.0;
-  _r_sigma = 0.0;
-  _r_theta = 0.0;
-  for (int i = 0; i < _n; i++)
-  {
-    double p_mu  = gsl_vector_get(previous_mu, i);
-    double mu    = gsl_vector_get(_mu, i);
-    _r_mu       += (mu-p_mu)*(mu-p_mu);
-    if (_noise_type != NONE)
-    {
-      double p_sigma  = gsl_vector_get(previous_sigma, i);
-      double sigma    = gsl_vector_get(_sigma, i);
-      _r_sigma       += (sigma-p_sigma)*(sigma-p_sigma);
-    }
-  }
-  if (_n > 1 && _noise_type == FULL)
-  {
-    for (int i = 0; i < _n*(_n-1)/2; i++)
-    {
-      double p_theta  = gsl_vector_get(previous_theta, i);
-      double theta    = gsl_vector_get(_theta, i);
-      _r_theta       += (theta-p_theta)*(theta-p_theta);
-    }
-  }
   _r_mu    = sqrt(_r_mu);
   _r_sigma = sqrt(_r_sigma);
   _r_theta = sqrt(_r_theta);
-  
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 6) Free memory            */
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  gsl_vector_free(previous_mu);
-  previous_mu = NULL;
-  gsl_vector_free(previous_sigma);
-  previous_sigma = NULL;
-  gsl_vector_free(previous_theta);
-  previous_theta = NULL;
 }
 
 /**
@@ -382,14 +428,15 @@ void Individual::mutate( double m_mu, double m_sigma, double m_theta, double s_m
  */
 void Individual::build_phenotype( void )
 {
+  INSTRUMENT_SCOPE(TRACE_PHENOTYPE);
   if (!_phenotype_is_built)
   {
     if (_noise_type != NONE)
     {
       build_Sigma();
-      compute_dot_product();
       Cholesky_decomposition();
       clear_memory();
+      _diagnostics_are_computed = false;
     }
     _phenotype_is_built = true;
   }
@@ -398,27 +445,43 @@ void Individual::build_phenotype( void )
 
 /**
  * \brief    Compute the fitness
- * \details  --
+ * \details  Only the fitness of the phenotype z is computed, since selection only needs it (see compute_mu_fitness())
  * \param    double alpha
  * \param    double beta
  * \param    double Q
  * \return   \e void
  */
 void Individual::compute_fitness( double alpha, double beta, double Q )
+{
+  INSTRUMENT_SCOPE(TRACE_FITNESS);
+  _dz = 0.0;
+  for (int i = 0; i < _n; i++)
+  {
+    double z_diff = gsl_vector_get(_z, i)-gsl_vector_get(_z_opt, i);
+    _dz          += z_diff*z_diff;
+  }
+  _dz = sqrt(_dz);
+  _Wz = (1.0-beta)*exp(-alpha*pow(_dz, Q))+beta;
+}
+
+/**
+ * \brief    Compute the fitness of the mean phenotype mu
+ * \details  --
+ * \param    double alpha
+ * \param    double beta
+ * \param    double Q
+ * \return   \e void
+ */
+void Individual::compute_mu_fitness( double alpha, double beta, double Q )
 {
   _dmu = 0.0;
-  _dz  = 0.0;
   for (int i = 0; i < _n; i++)
   {
     double mu_diff = gsl_vector_get(_mu, i)-gsl_vector_get(_z_opt, i);
-    double z_diff  = gsl_vector_get(_z, i)-gsl_vector_get(_z_opt, i);
     _dmu          += mu_diff*mu_diff;
-    _dz           += z_diff*z_diff;
   }
   _dmu = sqrt(_dmu);
-  _dz  = sqrt(_dz);
   _Wmu = (1.0-beta)*exp(-alpha*pow(_dmu, Q))+beta;
-  _Wz  = (1.0-beta)*exp(-alpha*pow(_dz, Q))+beta;
 }
 
 /**
@@ -431,8 +494,10 @@ void Individual::compute_fitness( double alpha, double beta, double Q )
  */
 void Individual::compute_mean_fitness( double alpha, double beta, double Q )
 {
+  INSTRUMENT_SCOPE(TRACE_MEAN_FITNESS);
   double mean_Wmu = 0.0;
   double mean_Wz  = 0.0;
+  compute_mu_fitness(alpha, beta, Q);
   for (int i = 0; i < 1000; i++)
   {
     draw_z();
@@ -444,6 +509,85 @@ void Individual::compute_mean_fitness( double alpha, double beta, double Q )
   _Wz  = mean_Wz/1000.0;
 }
 
+/**
+ * \brief    Compute the mapping properties
+ * \details  The maximum eigen value of Sigma, its contribution to the total variance and the alignment of its eigen vector
+ *           with the direction of the optimum are only reported by statistics and lineage records. They are thus computed
+ *           on demand, once the phenotype has been built, and before the optimum moves. The eigen vector is obtained by
+ *           applying the rotations of build_Sigma() to a single basis vector
+ * \param    void
+ * \return   \e void
+ */
+void Individual::compute_diagnostics( void )
+{
+  if (_diagnostics_are_computed)
+  {
+    return;
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Find the maximum eigenvalue and    */
+  /*    its contribution                   */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  _max_Sigma_eigenvalue = 0.0;
+  int    max_EV_index   = 0;
+  double EV_sum         = 0.0;
+  for (int i = 0; i < _n; i++)
+  {
+    double sigma = gsl_vector_get(_sigma, i);
+    EV_sum += sigma*sigma;
+    if (_max_Sigma_eigenvalue < sigma*sigma)
+    {
+      _max_Sigma_eigenvalue = sigma*sigma;
+      max_EV_index          = i;
+    }
+  }
+  _max_Sigma_contribution = _max_Sigma_eigenvalue/EV_sum;
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Rotate the corresponding basis     */
+  /*    vector                             */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  gsl_vector*     work        = gsl_vector_alloc(2*_n);
+  gsl_vector_view eigenvector = gsl_vector_subvector(work, 0, _n);
+  gsl_vector_view direction   = gsl_vector_subvector(work, _n, _n);
+  gsl_vector_set_zero(&eigenvector.vector);
+  gsl_vector_set(&eigenvector.vector, max_EV_index, 1.0);
+  if (_n > 1 && _noise_type == FULL)
+  {
+    int counter = 0;
+    for (int a = 0; a < _n; a++)
+    {
+      for (int b = a+1; b < _n; b++)
+      {
+        double theta = gsl_vector_get(_theta, counter);
+        double x_a   = gsl_vector_get(&eigenvector.vector, a);
+        double x_b   = gsl_vector_get(&eigenvector.vector, b);
+        gsl_vector_set(&eigenvector.vector, a, cos(theta)*x_a-sin(theta)*x_b);
+        gsl_vector_set(&eigenvector.vector, b, sin(theta)*x_a+cos(theta)*x_b);
+        counter++;
+      }
+    }
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Compute the dot product with the   */
+  /*    direction of the optimum           */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  gsl_vector_memcpy(&direction.vector, _z_opt);
+  gsl_vector_sub(&direction.vector, _mu);
+  double norm = gsl_blas_dnrm2(&direction.vector);
+  for (int i = 0; i < _n; i++)
+  {
+    gsl_vector_set(&direction.vector, i, gsl_vector_get(&direction.vector, i)/norm);
+  }
+  gsl_blas_ddot(&direction.vector, &eigenvector.vector, &_max_dot_product);
+  _max_dot_product = fabs(_max_dot_product);
+  gsl_vector_free(work);
+  work                      = NULL;
+  _diagnostics_are_computed = true;
+}
+
 /**
  * \brief    Delete all vectors and matrices
  * \details  --
@@ -462,8 +606,6 @@ void Individual::delete_vectors_and_matrices( void )
     _Sigma = NULL;
     gsl_matrix_free(_Cholesky);
     _Cholesky = NULL;
-    gsl_vector_free(_max_Sigma_eigenvector);
-    _max_Sigma_eigenvector = NULL;
     if (_n > 1 && _noise_type == FULL)
     {
       gsl_vector_free(_theta);
@@ -475,57 +617,54 @@ void Individual::delete_vectors_and_matrices( void )
 }
 
 /**
- * \brief    Write mu vector
+ * \brief    Save the individual in a backup file
  * \details  --
- * \param    int generation
+ * \param    std::ofstream& backup_file
  * \return   \e void
  */
-void Individual::write_mu( int generation )
+void Individual::save( std::ofstream& backup_file ) const
 {
-  std::stringstream filename;
-  filename << "output/mu_" << generation << ".txt";
-  std::ofstream file(filename.str(), std::ios::out | std::ios::trunc);
-  for (int i = 0; i < _n; i++)
+  /*----------------------------------------------- PARAMETERS */
+  
+  int noise_type = (int)_noise_type;
+  backup_file.write((char*)&_n, sizeof(_n));
+  backup_file.write((char*)&noise_type, sizeof(noise_type));
+  
+  /*----------------------------------------------- VARIABLES */
+  
+  backup_file.write((char*)&_identifier, sizeof(_identifier));
+  backup_file.write((char*)&_generation, sizeof(_generation));
+  backup_file.write((char*)_mu->data, sizeof(double)*_n);
+  if (_noise_type != NONE)
   {
-    file << gsl_vector_get(_mu, i) << "\n";
+    backup_file.write((char*)_sigma->data, sizeof(double)*_n);
   }
-  file.close();
-}
-
-/**
- * \brief    Write sigma vector
- * \details  --
- * \param    int generation
- * \return   \e void
- */
-void Individual::write_sigma( int generation )
-{
-  std::stringstream filename;
-  filename << "output/sigma_" << generation << ".txt";
-  std::ofstream file(filename.str(), std::ios::out | std::ios::trunc);
-  for (int i = 0; i < _n; i++)
+  if (_n > 1 && _noise_type == FULL)
   {
-    file << gsl_vector_get(_sigma, i) << "\n";
+    backup_file.write((char*)_theta->data, sizeof(double)*_n*(_n-1)/2);
   }
-  file.close();
-}
-
-/**
- * \brief    Write theta vector
- * \details  --
- * \param    int generation
- * \return   \e void
- */
-void Individual::write_theta( int generation )
-{
-  std::stringstream filename;
-  filename << "output/theta_" << generation << ".txt";
-  std::ofstream file(filename.str(), std::ios::out | std::ios::trunc);
-  for (int i = 0; i < _n*(_n-1)/2; i++)
+  backup_file.write((char*)&_phenotype_is_built, sizeof(_phenotype_is_built));
+  if (_phenotype_is_built && _noise_type != NONE)
   {
-    file << gsl_vector_get(_theta, i) << "\n";
+    backup_file.write((char*)_Cholesky->data, sizeof(double)*_n*_n);
   }
-  file.close();
+  backup_file.write((char*)_z->data, sizeof(double)*_n);
+  backup_file.write((char*)&_dmu, sizeof(_dmu));
+  backup_file.write((char*)&_dz, sizeof(_dz));
+  backup_file.write((char*)&_Wmu, sizeof(_Wmu));
+  backup_file.write((char*)&_Wz, sizeof(_Wz));
+  
+  /*----------------------------------------------- MAPPING PROPERTIES */
+  
+  backup_file.write((char*)&_max_Sigma_eigenvalue, sizeof(_max_Sigma_eigenvalue));
+  backup_file.write((char*)&_max_Sigma_contribution, sizeof(_max_Sigma_contribution));
+  backup_file.write((char*)&_max_dot_product, sizeof(_max_dot_product));
+  
+  /*----------------------------------------------- MUTATIONS */
+  
+  backup_file.write((char*)&_r_mu, sizeof(_r_mu));
+  backup_file.write((char*)&_r_sigma, sizeof(_r_sigma));
+  backup_file.write((char*)&_r_theta, sizeof(_r_theta));
 }
 
 /*----------------------------
@@ -562,6 +701,7 @@ void Individual::rotate( gsl_matrix* m, int a, int b, double theta )
  */
 void Individual::build_Sigma( void )
 {
+  INSTRUMENT_SCOPE(TRACE_SIGMA);
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   /* 1) Create eigenvectors matrix         */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -590,36 +730,16 @@ void Individual::build_Sigma( void )
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   /* 3) Create the matrix D of eigenvalues */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  _max_Sigma_eigenvalue = 0.0;
-  int    max_EV_index   = 0;
-  double EV_sum         = 0.0;
   gsl_matrix* D = gsl_matrix_alloc(_n, _n);
   gsl_matrix_set_zero(D);
   for (int i = 0; i < _n; i++)
   {
     double sigma = gsl_vector_get(_sigma, i);
     gsl_matrix_set(D, i, i, sigma*sigma);
-    EV_sum += sigma*sigma;
-    if (_max_Sigma_eigenvalue < sigma*sigma)
-    {
-      _max_Sigma_eigenvalue = sigma*sigma;
-      max_EV_index          = i;
-    }
-  }
-  
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 4) Save maximum eigenvector and       */
-  /*    eigenvalue contribution            */
-  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  _max_Sigma_eigenvector  = gsl_vector_alloc(_n);
-  _max_Sigma_contribution = _max_Sigma_eigenvalue/EV_sum;
-  for (int i = 0; i < _n; i++)
-  {
-    gsl_vector_set(_max_Sigma_eigenvector, i, gsl_matrix_get(X, i, max_EV_index));
   }
   
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-  /* 5) Compute Sigma = X * D * X^-1       */
+  /* 4) Compute Sigma = X * D * X^-1       */
   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   gsl_matrix* P = gsl_matrix_alloc(_n, _n);
   _Sigma        = gsl_matrix_alloc(_n, _n);
@@ -634,29 +754,6 @@ void Individual::build_Sigma( void )
   P = NULL;
 }
 
-/**
- * \brief    Compute the dot product between Sigma eigen vector and optimum direction
- * \details  --
- * \param    void
- * \return   \e void
- */
-void Individual::compute_dot_product( void )
-{
-  _max_dot_product = 0.0;
-  gsl_vector* d    = gsl_vector_alloc(_n);
-  gsl_vector_memcpy(d, _z_opt);
-  gsl_vector_sub(d, _mu);
-  double norm = gsl_blas_dnrm2(d);
-  for (int i = 0; i < _n; i++)
-  {
-    gsl_vector_set(d, i, gsl_vector_get(d, i)/norm);
-  }
-  gsl_blas_ddot(d, _max_Sigma_eigenvector, &_max_dot_product);
-  gsl_vector_free(d);
-  d = NULL;
-  _max_dot_product = fabs(_max_dot_product);
-}
-
 /**
  * \brief    Compute cholesky decomposition
  * \details  --
@@ -665,6 +762,7 @@ void Individual::compute_dot_product( void )
  */
 void Individual::Cholesky_decomposition( void )
 {
+  INSTRUMENT_SCOPE(TRACE_CHOLESKY);
   gsl_matrix_free(_Cholesky);
   _Cholesky = NULL;
   _Cholesky = gsl_matrix_alloc(_n, _n);
@@ -681,6 +779,7 @@ void Individual::Cholesky_decomposition( void )
  */
 void Individual::draw_z( void )
 {
+  INSTRUMENT_SCOPE(TRACE_DRAW_Z);
   if (_noise_type == NONE)
   {
     /* Copy mu vector in z vector */
@@ -710,7 +809,5 @@ void Individual::clear_memory( void )
 {
   gsl_matrix_free(_Sigma);
   _Sigma = NULL;
-  gsl_vector_free(_max_Sigma_eigenvector);
-  _max_Sigma_eigenvector = NULL;
 }
 
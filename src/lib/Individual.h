@@ -45,6 +45,7 @@
 #include "Macros.h"
 #include "Enums.h"
 #include "Prng.h"
+#include "Instrumentation.h"
 
 
 class Individual
@@ -57,6 +58,7 @@ public:
    *----------------------------*/
   Individual( void ) = delete;
   Individual( Prng* prng, int n, double mu_init, double sigma_init, double theta_init, bool oneD_shift, type_of_noise noise_type, gsl_vector* z_opt );
+  Individual( Prng* prng, gsl_vector* z_opt, std::ifstream& backup_file );
   Individual( const Individual& individual );
   
   /*----------------------------
@@ -75,6 +77,7 @@ public:
   inline double                 get_mu( int i ) const;
   inline double                 get_sigma( int i ) const;
   inline double                 get_theta( int i ) const;
+  inline double                 get_z( int i ) const;
   inline double                 get_dmu( void ) const;
   inline double                 get_dz( void ) const;
   inline double                 get_Wmu( void ) const;
@@ -106,11 +109,11 @@ public:
   void mutate( double m_mu, double m_sigma, double m_theta, double s_mu, double s_sigma, double s_theta );
   void build_phenotype( void );
   void compute_fitness( double alpha, double beta, double Q );
+  void compute_mu_fitness( double alpha, double beta, double Q );
   void compute_mean_fitness( double alpha, double beta, double Q );
+  void compute_diagnostics( void );
   void delete_vectors_and_matrices( void );
-  void write_mu( int generation );
-  void write_sigma( int generation );
-  void write_theta( int generation );
+  void save( std::ofstream& backup_file ) const;
   
   /*----------------------------
    * PUBLIC ATTRIBUTES
@@ -123,7 +126,6 @@ protected:
    *----------------------------*/
   void rotate( gsl_matrix* m, int a, int b, double theta );
   void build_Sigma( void );
-  void compute_dot_product( void );
   void Cholesky_decomposition( void );
   void draw_z( void );
   void clear_memory( void );
@@ -156,11 +158,11 @@ protected:
   
   /*----------------------------------------------- MAPPING PROPERTIES */
   
-  bool        _phenotype_is_built;     /*!< Indicates if the phenotype is built                             */
-  gsl_vector* _max_Sigma_eigenvector;  /*!< Eigen vector corresponding to the maximum variance of Sigma     */
-  double      _max_Sigma_eigenvalue;   /*!< Eigen value corresponding to the maximum variance of Sigma      */
-  double      _max_Sigma_contribution; /*!< Eigen value contribution to the total variance                  */
-  double      _max_dot_product;        /*!< Dot product of maximum Sigma eigen vector and optimum direction */
+  bool   _phenotype_is_built;       /*!< Indicates if the phenotype is built                             */
+  bool   _diagnostics_are_computed; /*!< Indicates if the mapping properties are computed                */
+  double _max_Sigma_eigenvalue;     /*!< Eigen value corresponding to the maximum variance of Sigma      */
+  double _max_Sigma_contribution;   /*!< Eigen value contribution to the total variance                  */
+  double _max_dot_product;          /*!< Dot product of maximum Sigma eigen vector and optimum direction */
   
   /*----------------------------------------------- MUTATIONS */
   
@@ -235,6 +237,18 @@ inline double Individual::get_theta( int i ) const
   return gsl_vector_get(_theta, i);
 }
 
+/**
+ * \brief    Get z value at position i
+ * \details  --
+ * \param    int i
+ * \return   \e double
+ */
+inline double Individual::get_z( int i ) const
+{
+  assert(i < _n);
+  return gsl_vector_get(_z, i);
+}
+
 /**
  * \brief    Get the euclidean distance d(mu)
  * \details  --
@@ -283,34 +297,37 @@ inline double Individual::get_Wz( void ) const
 
 /**
  * \brief    Get the maximum eigen value of Sigma
- * \details  --
+ * \details  Only valid once compute_diagnostics() has been called
  * \param    void
  * \return   \e double
  */
 inline double Individual::get_max_Sigma_eigenvalue( void ) const
 {
+  assert(_diagnostics_are_computed);
   return _max_Sigma_eigenvalue;
 }
 
 /**
  * \brief    Get the maximum eigen value contribution
- * \details  --
+ * \details  Only valid once compute_diagnostics() has been called
  * \param    void
  * \return   \e double
  */
 inline double Individual::get_max_Sigma_contribution( void ) const
 {
+  assert(_diagnostics_are_computed);
   return _max_Sigma_contribution;
 }
 
 /**
  * \brief    Get the dot product between Sigma maximum eigen vector and optimum direction
- * \details  --
+ * \details  Only valid once compute_diagnostics() has been called
  * \param    void
  * \return   \e double
  */
 inline double Individual::get_max_dot_product( void ) const
 {
+  assert(_diagnostics_are_computed);
   return _max_dot_product;
 }
 
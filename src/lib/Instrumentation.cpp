@@ -0,0 +1,234 @@
+
+/**
+ * \file      Instrumentation.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Instrumentation class definition
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "Instrumentation.h"
+
+thread_local Instrumentation* Instrumentation::_current = NULL;
+
+/**
+ * \brief   Zone descriptors, in the order of trace_zone
+ * \details --
+ */
+static const trace_zone_descriptor TRACE_ZONE_DESCRIPTORS[TRACE_ZONES] =
+{
+  {"reproduction", 1},
+  {"resampling", 1},
+  {"mutation", 1},
+  {"phenotype", 1},
+  {"sigma", 1},
+  {"cholesky", 1},
+  {"draw_z", 1},
+  {"fitness", 1},
+  {"mean_fitness", 1},
+  {"statistics", 1},
+  {"write_statistics", 1},
+  {"write_snapshot", 1},
+  {"write_checkpoint", 1},
+  {"mu_mutations", 0},
+  {"sigma_mutations", 0},
+  {"theta_mutations", 0},
+  {"generation", 1}
+};
+
+
+/*----------------------------
+ * CONSTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Constructor
+ * \details  The trace file is created in the output path. A resumed simulation appends its records to the existing file
+ *           (times then restart from zero)
+ * \param    Parameters* parameters
+ * \param    bool append
+ * \return   \e void
+ */
+Instrumentation::Instrumentation( Parameters* parameters, bool append )
+{
+  assert(parameters != NULL);
+  
+  /*----------------------------------------------- MEASURES */
+  
+  _origin = std::chrono::steady_clock::now();
+  memset(_records, 0, sizeof(trace_record)*TRACE_ZONES);
+#ifdef WITH_HARDWARE_COUNTERS
+  _hardware_counters.open();
+  if (!_hardware_counters.is_available())
+  {
+    printf("Warning: hardware counters are unavailable (see /proc/sys/kernel/perf_event_paranoid), they are recorded as zero.\n");
+  }
+#endif
+  start_generation();
+  
+  /*----------------------------------------------- TRACE FILE */
+  
+  std::string filename = parameters->get_output_filename(TRACE_FILE);
+  _file.open(filename.c_str(), (append ? std::ios::out | std::ios::app | std::ios::binary : std::ios::out | std::ios::trunc | std::ios::binary));
+  if (!_file)
+  {
+    printf("Error in Instrumentation::Instrumentation(): impossible to open trace file %s. Exit.\n", filename.c_str());
+    exit(EXIT_FAILURE);
+  }
+  if (append)
+  {
+    return;
+  }
+  trace_header header;
+  memset(&header, 0, sizeof(trace_header));
+  memcpy(header.magic, TRACE_MAGIC, 8);
+  header.version           = TRACE_VERSION;
+  header.number_of_zones   = TRACE_ZONES;
+  header.hardware_counters = (_hardware_counters.is_available() ? 1 : 0);
+  _file.write((char*)&header, sizeof(trace_header));
+  _file.write((char*)TRACE_ZONE_DESCRIPTORS, sizeof(trace_zone_descriptor)*TRACE_ZONES);
+}
+
+/*----------------------------
+ * DESTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Destructor
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+Instrumentation::~Instrumentation( void )
+{
+  if (_current == this)
+  {
+    _current = NULL;
+  }
+  _file.close();
+}
+
+/*----------------------------
+ * PUBLIC METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Bind the instrumentation to the calling thread
+ * \details  A simulation is computed by a single thread at a time: it binds its instrumentation before computing generations,
+ *           which also starts the next generation measure. Hardware counters are reopened for the calling thread
+ * \param    void
+ * \return   \e void
+ */
+void Instrumentation::bind( void )
+{
+  _current = this;
+#ifdef WITH_HARDWARE_COUNTERS
+  _hardware_counters.open();
+#endif
+  start_generation();
+}
+
+/**
+ * \brief    End a generation
+ * \details  Writes the record of the whole generation and of every zone active during the generation, then resets them
+ * \param    simulation_phase phase
+ * \param    int generation
+ * \return   \e void
+ */
+void Instrumentation::end_generation( simulation_phase phase, int generation )
+{
+  trace_record& record = _records[TRACE_GENERATION];
+  record.start         = _generation_start;
+  record.end           = get_time();
+  record.busy          = record.end-record.start;
+  record.calls         = 1;
+  record.allocations   = get_allocations()-_generation_allocations;
+  record.bytes         = get_allocated_bytes()-_generation_bytes;
+  unsigned long long int counters[HW_COUNTERS];
+  _hardware_counters.sample(counters);
+  for (int counter = 0; counter < HW_COUNTERS; counter++)
+  {
+    record.counters[counter] = counters[counter]-_generation_counters[counter];
+  }
+  for (int zone = 0; zone < TRACE_ZONES; zone++)
+  {
+    if (_records[zone].calls > 0)
+    {
+      _records[zone].phase      = (long long int)phase;
+      _records[zone].generation = (long long int)generation;
+      _records[zone].zone       = (long long int)zone;
+      _file.write((char*)&_records[zone], sizeof(trace_record));
+    }
+  }
+  _file.flush();
+  memset(_records, 0, sizeof(trace_record)*TRACE_ZONES);
+  start_generation();
+}
+
+/*----------------------------
+ * PROTECTED METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Get the number of heap allocations of the calling thread
+ * \details  The counting allocator is only linked in builds WITH_INSTRUMENTATION
+ * \param    void
+ * \return   \e unsigned long long int
+ */
+unsigned long long int Instrumentation::get_allocations( void )
+{
+#ifdef WITH_INSTRUMENTATION
+  return AllocationCounter::get_allocations();
+#else
+  return 0;
+#endif
+}
+
+/**
+ * \brief    Get the number of bytes allocated by the calling thread
+ * \details  The counting allocator is only linked in builds WITH_INSTRUMENTATION
+ * \param    void
+ * \return   \e unsigned long long int
+ */
+unsigned long long int Instrumentation::get_allocated_bytes( void )
+{
+#ifdef WITH_INSTRUMENTATION
+  return AllocationCounter::get_allocated_bytes();
+#else
+  return 0;
+#endif
+}
+
+/**
+ * \brief    Start the measure of a generation
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void Instrumentation::start_generation( void )
+{
+  _generation_start       = get_time();
+  _generation_allocations = get_allocations();
+  _generation_bytes       = get_allocated_bytes();
+  _hardware_counters.sample(_generation_counters);
+}
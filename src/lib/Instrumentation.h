@@ -0,0 +1,327 @@
+
+/**
+ * \file      Instrumentation.h
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Instrumentation class declaration
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#ifndef __SigmaFGM__Instrumentation__
+#define __SigmaFGM__Instrumentation__
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstring>
+#include <assert.h>
+
+#include "Macros.h"
+#include "Enums.h"
+#include "Structs.h"
+#include "Parameters.h"
+#include "AllocationCounter.h"
+#include "HardwareCounters.h"
+
+/**
+ * Instrumentation macros. They are only compiled with the CMake option WITH_INSTRUMENTATION, and expand to nothing otherwise:
+ * - INSTRUMENT_SCOPE(zone) times the rest of the enclosing scope, and counts its heap allocations,
+ * - INSTRUMENT_COUNT(zone) counts an event.
+ * Measures go to the instrumentation bound to the calling thread, if any. With the CMake option WITH_HARDWARE_COUNTERS,
+ * scopes also sample the hardware counters of the thread (see HardwareCounters.h).
+ */
+#ifdef WITH_INSTRUMENTATION
+#define INSTRUMENT_CONCATENATE(a, b) a##b
+#define INSTRUMENT_VARIABLE(line)    INSTRUMENT_CONCATENATE(instrumented_scope_, line)
+#define INSTRUMENT_SCOPE(zone)       InstrumentedScope INSTRUMENT_VARIABLE(__LINE__)(zone)
+#define INSTRUMENT_COUNT(zone)       Instrumentation::count(zone)
+#else
+#define INSTRUMENT_SCOPE(zone)
+#define INSTRUMENT_COUNT(zone)
+#endif
+
+
+class Instrumentation
+{
+  
+public:
+  
+  /*----------------------------
+   * CONSTRUCTORS
+   *----------------------------*/
+  Instrumentation( void ) = delete;
+  Instrumentation( Parameters* parameters, bool append );
+  Instrumentation( const Instrumentation& instrumentation ) = delete;
+  
+  /*----------------------------
+   * DESTRUCTORS
+   *----------------------------*/
+  ~Instrumentation( void );
+  
+  /*----------------------------
+   * GETTERS
+   *----------------------------*/
+  inline static Instrumentation* get_current( void );
+  inline double                  get_time( void ) const;
+  
+  /*----------------------------
+   * SETTERS
+   *----------------------------*/
+  Instrumentation& operator=(const Instrumentation&) = delete;
+  
+  /*----------------------------
+   * PUBLIC METHODS
+   *----------------------------*/
+  void               bind( void );
+  inline void        add_time( trace_zone zone, double start, double end, unsigned long long int allocations, unsigned long long int bytes );
+  inline static void count( trace_zone zone );
+  inline void        sample_counters( unsigned long long int* values ) const;
+  inline void        add_counters( trace_zone zone, const unsigned long long int* start );
+  void               end_generation( simulation_phase phase, int generation );
+  
+  /*----------------------------
+   * PUBLIC ATTRIBUTES
+   *----------------------------*/
+  
+protected:
+  
+  /*----------------------------
+   * PROTECTED METHODS
+   *----------------------------*/
+  static unsigned long long int get_allocations( void );
+  static unsigned long long int get_allocated_bytes( void );
+  void                          start_generation( void );
+  
+  /*----------------------------
+   * PROTECTED ATTRIBUTES
+   *----------------------------*/
+  
+  /*----------------------------------------------- BINDING */
+  
+  static thread_local Instrumentation* _current; /*!< Instrumentation bound to the calling thread */
+  
+  /*----------------------------------------------- MEASURES */
+  
+  std::chrono::steady_clock::time_point _origin;                           /*!< Creation time                              */
+  trace_record                          _records[TRACE_ZONES];             /*!< Activity of each zone this generation      */
+  double                                _generation_start;                 /*!< Start time of the generation               */
+  unsigned long long int                _generation_allocations;           /*!< Allocations of the thread at the start     */
+  unsigned long long int                _generation_bytes;                 /*!< Bytes allocated by the thread at the start */
+  HardwareCounters                      _hardware_counters;                /*!< Hardware counters of the bound thread      */
+  unsigned long long int                _generation_counters[HW_COUNTERS]; /*!< Hardware counters at the start             */
+  
+  /*----------------------------------------------- TRACE FILE */
+  
+  std::ofstream _file; /*!< Trace file */
+};
+
+/**
+ * \brief   Instrumented scope
+ * \details Times its own lifetime and counts the allocations of the calling thread meanwhile, see INSTRUMENT_SCOPE
+ */
+class InstrumentedScope
+{
+  
+public:
+  
+  /*----------------------------
+   * CONSTRUCTORS
+   *----------------------------*/
+  InstrumentedScope( void ) = delete;
+  inline InstrumentedScope( trace_zone zone );
+  InstrumentedScope( const InstrumentedScope& scope ) = delete;
+  
+  /*----------------------------
+   * DESTRUCTORS
+   *----------------------------*/
+  inline ~InstrumentedScope( void );
+  
+  /*----------------------------
+   * SETTERS
+   *----------------------------*/
+  InstrumentedScope& operator=(const InstrumentedScope&) = delete;
+  
+protected:
+  
+  /*----------------------------
+   * PROTECTED ATTRIBUTES
+   *----------------------------*/
+  Instrumentation*       _instrumentation;       /*!< Instrumentation bound when the scope started */
+  trace_zone             _zone;                  /*!< Timed zone                                   */
+  double                 _start;                 /*!< Start time                                   */
+  unsigned long long int _allocations;           /*!< Allocations of the thread at the start       */
+  unsigned long long int _bytes;                 /*!< Bytes allocated by the thread at the start   */
+#ifdef WITH_HARDWARE_COUNTERS
+  unsigned long long int _counters[HW_COUNTERS]; /*!< Hardware counters at the start               */
+#endif
+};
+
+
+/*----------------------------
+ * GETTERS
+ *----------------------------*/
+
+/**
+ * \brief    Get the instrumentation bound to the calling thread
+ * \details  Returns NULL if the thread is not running an instrumented simulation
+ * \param    void
+ * \return   \e Instrumentation*
+ */
+inline Instrumentation* Instrumentation::get_current( void )
+{
+  return _current;
+}
+
+/**
+ * \brief    Get the time elapsed since the creation of the instrumentation
+ * \details  Monotonic clock, in microseconds
+ * \param    void
+ * \return   \e double
+ */
+inline double Instrumentation::get_time( void ) const
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now()-_origin).count();
+}
+
+/*----------------------------
+ * SETTERS
+ *----------------------------*/
+
+/*----------------------------
+ * PUBLIC METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Add a call to a timed zone
+ * \details  --
+ * \param    trace_zone zone
+ * \param    double start
+ * \param    double end
+ * \param    unsigned long long int allocations
+ * \param    unsigned long long int bytes
+ * \return   \e void
+ */
+inline void Instrumentation::add_time( trace_zone zone, double start, double end, unsigned long long int allocations, unsigned long long int bytes )
+{
+  trace_record& record = _records[zone];
+  if (record.calls == 0)
+  {
+    record.start = start;
+  }
+  record.end          = end;
+  record.busy        += end-start;
+  record.calls++;
+  record.allocations += allocations;
+  record.bytes       += bytes;
+}
+
+/**
+ * \brief    Read the hardware counters of the bound thread
+ * \details  Values are zero if the counters are unavailable
+ * \param    unsigned long long int* values
+ * \return   \e void
+ */
+inline void Instrumentation::sample_counters( unsigned long long int* values ) const
+{
+  _hardware_counters.sample(values);
+}
+
+/**
+ * \brief    Add the hardware counters of a call to a timed zone
+ * \details  --
+ * \param    trace_zone zone
+ * \param    const unsigned long long int* start
+ * \return   \e void
+ */
+inline void Instrumentation::add_counters( trace_zone zone, const unsigned long long int* start )
+{
+  unsigned long long int end[HW_COUNTERS];
+  _hardware_counters.sample(end);
+  for (int counter = 0; counter < HW_COUNTERS; counter++)
+  {
+    _records[zone].counters[counter] += end[counter]-start[counter];
+  }
+}
+
+/**
+ * \brief    Count an event
+ * \details  --
+ * \param    trace_zone zone
+ * \return   \e void
+ */
+inline void Instrumentation::count( trace_zone zone )
+{
+  if (_current != NULL)
+  {
+    _current->_records[zone].calls++;
+  }
+}
+
+/*----------------------------
+ * CONSTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Constructor
+ * \details  Starts timing if an instrumentation is bound to the calling thread
+ * \param    trace_zone zone
+ * \return   \e void
+ */
+inline InstrumentedScope::InstrumentedScope( trace_zone zone )
+{
+  _instrumentation = Instrumentation::get_current();
+  _zone            = zone;
+  _start           = (_instrumentation != NULL ? _instrumentation->get_time() : 0.0);
+  _allocations     = AllocationCounter::get_allocations();
+  _bytes           = AllocationCounter::get_allocated_bytes();
+#ifdef WITH_HARDWARE_COUNTERS
+  if (_instrumentation != NULL)
+  {
+    _instrumentation->sample_counters(_counters);
+  }
+#endif
+}
+
+/*----------------------------
+ * DESTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Destructor
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+inline InstrumentedScope::~InstrumentedScope( void )
+{
+  if (_instrumentation != NULL)
+  {
+#ifdef WITH_HARDWARE_COUNTERS
+    _instrumentation->add_counters(_zone, _counters);
+#endif
+    _instrumentation->add_time(_zone, _start, _instrumentation->get_time(), AllocationCounter::get_allocations()-_allocations, AllocationCounter::get_allocated_bytes()-_bytes);
+  }
+}
+
+
+#endif /* defined(__SigmaFGM__Instrumentation__) */
@@ -0,0 +1,261 @@
+
+/**
+ * \file      LineOfDescent.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     LineOfDescent class definition
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "LineOfDescent.h"
+
+
+/*----------------------------
+ * CONSTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Constructor
+ * \details  The whole ring is allocated once: the depth is given by the parameters
+ * \param    Parameters* parameters
+ * \return   \e void
+ */
+LineOfDescent::LineOfDescent( Parameters* parameters )
+{
+  assert(parameters != NULL);
+  assert(parameters->get_line_of_descent_depth() > 0);
+  
+  /*----------------------------------------------- RING LAYOUT */
+  
+  _depth           = parameters->get_line_of_descent_depth();
+  _population_size = parameters->get_population_size();
+  
+  /*----------------------------------------------- HISTORY */
+  
+  _parents               = new int[(size_t)_depth*_population_size];
+  _records               = new lod_record[(size_t)_depth*_population_size];
+  _first_identifiers     = new unsigned long long int[_depth];
+  _last_generation       = 0;
+  _number_of_generations = 1;
+  _number_of_individuals = 0;
+}
+
+/**
+ * \brief    Constructor from backup file
+ * \details  --
+ * \param    Parameters* parameters
+ * \param    std::ifstream& backup_file
+ * \return   \e void
+ */
+LineOfDescent::LineOfDescent( Parameters* parameters, std::ifstream& backup_file )
+{
+  assert(parameters != NULL);
+  
+  /*----------------------------------------------- RING LAYOUT */
+  
+  backup_file.read((char*)&_depth, sizeof(_depth));
+  backup_file.read((char*)&_population_size, sizeof(_population_size));
+  if (_population_size != parameters->get_population_size())
+  {
+    printf("Error in LineOfDescent::LineOfDescent(): population size does not match the checkpointed line of descent. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  
+  /*----------------------------------------------- HISTORY */
+  
+  _parents           = new int[(size_t)_depth*_population_size];
+  _records           = new lod_record[(size_t)_depth*_population_size];
+  _first_identifiers = new unsigned long long int[_depth];
+  backup_file.read((char*)_parents, sizeof(int)*_depth*_population_size);
+  backup_file.read((char*)_records, sizeof(lod_record)*_depth*_population_size);
+  backup_file.read((char*)_first_identifiers, sizeof(unsigned long long int)*_depth);
+  backup_file.read((char*)&_last_generation, sizeof(_last_generation));
+  backup_file.read((char*)&_number_of_generations, sizeof(_number_of_generations));
+  backup_file.read((char*)&_number_of_individuals, sizeof(_number_of_individuals));
+}
+
+/*----------------------------
+ * DESTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Destructor
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+LineOfDescent::~LineOfDescent( void )
+{
+  delete[] _parents;
+  _parents = NULL;
+  delete[] _records;
+  _records = NULL;
+  delete[] _first_identifiers;
+  _first_identifiers = NULL;
+}
+
+/*----------------------------
+ * PUBLIC METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Add a root
+ * \details  Roots are added before the first reproduction event
+ * \param    Individual* individual
+ * \return   \e void
+ */
+void LineOfDescent::add_root( Individual* individual )
+{
+  assert(_last_generation == 0);
+  record(-1, individual);
+}
+
+/**
+ * \brief    Start a new generation
+ * \details  The slot of the oldest generation is reused once the ring is full
+ * \param    void
+ * \return   \e void
+ */
+void LineOfDescent::new_generation( void )
+{
+  _last_generation++;
+  _number_of_individuals = 0;
+  if (_number_of_generations < _depth)
+  {
+    _number_of_generations++;
+  }
+}
+
+/**
+ * \brief    Add a reproduction event
+ * \details  The parent is given by its index in the previous generation
+ * \param    int parent
+ * \param    Individual* child
+ * \return   \e void
+ */
+void LineOfDescent::add_reproduction_event( int parent, Individual* child )
+{
+  assert(_last_generation > 0);
+  assert(parent >= 0);
+  assert(parent < _population_size);
+  record(parent, child);
+}
+
+/**
+ * \brief    Write the line of descent of the best alive individual
+ * \details  Same format as best_lineage.txt. The line of descent stops at the oldest generation kept in the ring
+ * \param    std::string filename
+ * \return   \e void
+ */
+void LineOfDescent::write_line_of_descent( std::string filename ) const
+{
+  int index = get_best_alive_individual();
+  std::ofstream file(filename.c_str(), std::ios::out | std::ios::trunc);
+  file << "id" << " ";
+  file << "t" << " ";
+  file << "dmu" << " ";
+  file << "dz" << " ";
+  file << "Wmu" << " ";
+  file << "Wz" << " ";
+  file << "EV" << " ";
+  file << "EV_contrib" << " ";
+  file << "EV_dot_product" << " ";
+  file << "r_mu" << " ";
+  file << "r_sigma" << " ";
+  file << "r_theta" << "\n";
+  int first_generation = _last_generation-_number_of_generations+1;
+  for (int g = _last_generation; g >= first_generation && index >= 0; g--)
+  {
+    size_t            position = (size_t)get_slot(g)*_population_size+index;
+    const lod_record* current  = &_records[position];
+    file << _first_identifiers[get_slot(g)]+(unsigned long long int)index << " ";
+    file << g << " ";
+    file << current->dmu << " ";
+    file << current->dz << " ";
+    file << current->Wmu << " ";
+    file << current->Wz << " ";
+    file << current->EV << " ";
+    file << current->EV_contrib << " ";
+    file << current->EV_dot_product << " ";
+    file << current->r_mu << " ";
+    file << current->r_sigma << " ";
+    file << current->r_theta << "\n";
+    index = _parents[position];
+  }
+  file.close();
+}
+
+/**
+ * \brief    Save the line of descent in a backup file
+ * \details  --
+ * \param    std::ofstream& backup_file
+ * \return   \e void
+ */
+void LineOfDescent::save( std::ofstream& backup_file ) const
+{
+  backup_file.write((char*)&_depth, sizeof(_depth));
+  backup_file.write((char*)&_population_size, sizeof(_population_size));
+  backup_file.write((char*)_parents, sizeof(int)*_depth*_population_size);
+  backup_file.write((char*)_records, sizeof(lod_record)*_depth*_population_size);
+  backup_file.write((char*)_first_identifiers, sizeof(unsigned long long int)*_depth);
+  backup_file.write((char*)&_last_generation, sizeof(_last_generation));
+  backup_file.write((char*)&_number_of_generations, sizeof(_number_of_generations));
+  backup_file.write((char*)&_number_of_individuals, sizeof(_number_of_individuals));
+}
+
+/*----------------------------
+ * PROTECTED METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Record an individual in the last slot
+ * \details  Individuals of a generation receive consecutive identifiers, so that only the first one is stored
+ * \param    int parent
+ * \param    Individual* individual
+ * \return   \e void
+ */
+void LineOfDescent::record( int parent, Individual* individual )
+{
+  assert(individual != NULL);
+  assert(_number_of_individuals < _population_size);
+  int slot = get_slot(_last_generation);
+  if (_number_of_individuals == 0)
+  {
+    _first_identifiers[slot] = individual->get_identifier();
+  }
+  assert(individual->get_identifier() == _first_identifiers[slot]+(unsigned long long int)_number_of_individuals);
+  size_t      position    = (size_t)slot*_population_size+_number_of_individuals;
+  lod_record* current     = &_records[position];
+  _parents[position]      = parent;
+  current->dmu            = individual->get_dmu();
+  current->dz             = individual->get_dz();
+  current->Wmu            = individual->get_Wmu();
+  current->Wz             = individual->get_Wz();
+  current->EV             = individual->get_max_Sigma_eigenvalue();
+  current->EV_contrib     = individual->get_max_Sigma_contribution();
+  current->EV_dot_product = individual->get_max_dot_product();
+  current->r_mu           = individual->get_r_mu();
+  current->r_sigma        = individual->get_r_sigma();
+  current->r_theta        = individual->get_r_theta();
+  _number_of_individuals++;
+}
@@ -0,0 +1,186 @@
+
+/**
+ * \file      LineOfDescent.h
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     LineOfDescent class declaration
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#ifndef __SigmaFGM__LineOfDescent__
+#define __SigmaFGM__LineOfDescent__
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <assert.h>
+
+#include "Macros.h"
+#include "Enums.h"
+#include "Structs.h"
+#include "Parameters.h"
+#include "Individual.h"
+
+
+class LineOfDescent
+{
+  
+public:
+  
+  /*----------------------------
+   * CONSTRUCTORS
+   *----------------------------*/
+  LineOfDescent( void ) = delete;
+  LineOfDescent( Parameters* parameters );
+  LineOfDescent( Parameters* parameters, std::ifstream& backup_file );
+  LineOfDescent( const LineOfDescent& line_of_descent ) = delete;
+  
+  /*----------------------------
+   * DESTRUCTORS
+   *----------------------------*/
+  ~LineOfDescent( void );
+  
+  /*----------------------------
+   * GETTERS
+   *----------------------------*/
+  inline int get_depth( void ) const;
+  inline int get_number_of_generations( void ) const;
+  inline int get_best_alive_individual( void ) const;
+  
+  /*----------------------------
+   * SETTERS
+   *----------------------------*/
+  LineOfDescent& operator=(const LineOfDescent&) = delete;
+  
+  /*----------------------------
+   * PUBLIC METHODS
+   *----------------------------*/
+  void add_root( Individual* individual );
+  void new_generation( void );
+  void add_reproduction_event( int parent, Individual* child );
+  void write_line_of_descent( std::string filename ) const;
+  void save( std::ofstream& backup_file ) const;
+  
+  /*----------------------------
+   * PUBLIC ATTRIBUTES
+   *----------------------------*/
+  
+protected:
+  
+  /*----------------------------
+   * PROTECTED METHODS
+   *----------------------------*/
+  inline int get_slot( int generation ) const;
+  void       record( int parent, Individual* individual );
+  
+  /*----------------------------
+   * PROTECTED ATTRIBUTES
+   *----------------------------*/
+  
+  /*----------------------------------------------- RING LAYOUT */
+  
+  int _depth;           /*!< Number of generations kept in the ring */
+  int _population_size; /*!< Number of individuals per generation   */
+  
+  /*----------------------------------------------- HISTORY */
+  
+  int*                    _parents;               /*!< Parent index of each individual, one slot per generation */
+  lod_record*             _records;               /*!< Reported statistics of each individual                   */
+  unsigned long long int* _first_identifiers;     /*!< Identifier of the first individual of each generation    */
+  int                     _last_generation;       /*!< Generation of the last slot                              */
+  int                     _number_of_generations; /*!< Number of generations in the ring                        */
+  int                     _number_of_individuals; /*!< Number of individuals recorded in the last slot          */
+};
+
+
+/*----------------------------
+ * GETTERS
+ *----------------------------*/
+
+/**
+ * \brief    Get the number of generations kept in the ring
+ * \details  --
+ * \param    void
+ * \return   \e int
+ */
+inline int LineOfDescent::get_depth( void ) const
+{
+  return _depth;
+}
+
+/**
+ * \brief    Get the number of generations currently in the ring
+ * \details  --
+ * \param    void
+ * \return   \e int
+ */
+inline int LineOfDescent::get_number_of_generations( void ) const
+{
+  return _number_of_generations;
+}
+
+/**
+ * \brief    Get best alive individual
+ * \details  Returns the index of the best individual of the last generation (-1 if the generation is empty)
+ * \param    void
+ * \return   \e int
+ */
+inline int LineOfDescent::get_best_alive_individual( void ) const
+{
+  const lod_record* alive           = &_records[(size_t)get_slot(_last_generation)*_population_size];
+  double            best_w          = 0.0;
+  int               best_individual = -1;
+  for (int i = 0; i < _number_of_individuals; i++)
+  {
+    if (best_w < alive[i].Wz)
+    {
+      best_w          = alive[i].Wz;
+      best_individual = i;
+    }
+  }
+  return best_individual;
+}
+
+/*----------------------------
+ * SETTERS
+ *----------------------------*/
+
+/*----------------------------
+ * PROTECTED METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Get the ring slot of a generation
+ * \details  --
+ * \param    int generation
+ * \return   \e int
+ */
+inline int LineOfDescent::get_slot( int generation ) const
+{
+  assert(generation >= 0);
+  return generation%_depth;
+}
+
+
+#endif /* defined(__SigmaFGM__LineOfDescent__) */
@@ -30,5 +30,22 @@
 #ifndef __SigmaFGM__Macros__
 #define __SigmaFGM__Macros__
 
+#define SNAPSHOT_MAGIC     "SFGMSNAP"       /*!< Population snapshot file signature           */
+#define SNAPSHOT_VERSION   1                /*!< Population snapshot format version           */
+#define SNAPSHOT_ALIGNMENT 64               /*!< Byte alignment of population snapshot blocks */
+#define CHECKPOINT_MAGIC   "SFGMCKPT"       /*!< Checkpoint file signature                    */
+#define CHECKPOINT_VERSION 4                /*!< Checkpoint format version                    */
+#define CHECKPOINT_FILE    "checkpoint.bin" /*!< Checkpoint file name                         */
+#define CHECKPOINT_NAME    256              /*!< Longest file name listed in a checkpoint     */
+#define TELEMETRY_FILE     "telemetry.txt"  /*!< Telemetry file name                          */
+#define TELEMETRY_PHASES   6                /*!< Number of phases timed by the telemetry      */
+#define TELEMETRY_SAMPLING 16               /*!< One offspring out of 16 is timed             */
+#define TRACE_MAGIC        "SFGMTRCE"       /*!< Instrumentation trace file signature         */
+#define TRACE_VERSION      3                /*!< Instrumentation trace format version         */
+#define TRACE_FILE         "trace.bin"      /*!< Instrumentation trace file name              */
+#define TRACE_ZONES        17               /*!< Number of instrumented zones                 */
+#define HW_COUNTERS        5                /*!< Number of hardware counters                  */
+#define TILE_CACHE_SIZE    262144           /*!< Default cache size of offspring tiles (B)    */
+#define MANDATORY_ARGS     17               /*!< Number of mandatory command line arguments   */
 
 #endif /* defined(__SigmaFGM__Macros__) */
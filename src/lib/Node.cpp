@@ -36,58 +36,63 @@
 
 /**
  * \brief    Constructor
- * \details  --
- * \param    unsigned long long int identifier
- * \param    int generation
- * \return   \e void
- */
-Node::Node( unsigned long long int identifier, int generation )
-{
-  assert(generation >= 0);
-  _identifier = identifier;
-  _generation = generation;
-  _individual = NULL;
-  _parent     = NULL;
-  _children.clear();
-  _node_class = MASTER_ROOT;
-  _node_state = DEAD;
-  _tagged     = false;
-}
-
-/**
- * \brief    Alive node constructor
- * \details  --
+ * \details  Only the statistics reported along lineages are copied from the individual
  * \param    Individual* individual
+ * \param    int parent
  * \return   \e void
  */
-Node::Node( Individual* individual )
+Node::Node( Individual* individual, int parent )
 {
-  _identifier = individual->get_identifier();
-  _generation = individual->get_generation();
-  _individual = new Individual(*individual);
-  _individual->delete_vectors_and_matrices();
-  _parent     = NULL;
-  _children.clear();
-  _node_class = NORMAL;
-  _node_state = ALIVE;
-  _tagged     = false;
+  assert(individual != NULL);
+  assert(parent >= -1);
+  
+  /*----------------------------------------------- GENEALOGY */
+  
+  _identifier  = individual->get_identifier();
+  _parent      = parent;
+  _offspring   = 0;
+  _first_child = 0;
+  _last_child  = 0;
+  _export_id   = -1;
+  
+  /*----------------------------------------------- REPORTED STATISTICS */
+  
+  _dmu            = individual->get_dmu();
+  _dz             = individual->get_dz();
+  _Wmu            = individual->get_Wmu();
+  _Wz             = individual->get_Wz();
+  _EV             = individual->get_max_Sigma_eigenvalue();
+  _EV_contrib     = individual->get_max_Sigma_contribution();
+  _EV_dot_product = individual->get_max_dot_product();
+  _r_mu           = individual->get_r_mu();
+  _r_sigma        = individual->get_r_sigma();
+  _r_theta        = individual->get_r_theta();
 }
 
-/*----------------------------
- * DESTRUCTORS
- *----------------------------*/
-
 /**
- * \brief    Destructor
+ * \brief    Constructor from backup file
  * \details  --
- * \param    void
+ * \param    std::ifstream& backup_file
  * \return   \e void
  */
-Node::~Node( void )
+Node::Node( std::ifstream& backup_file )
 {
-  delete _individual;
-  _individual = NULL;
-  _children.clear();
+  backup_file.read((char*)&_identifier, sizeof(_identifier));
+  backup_file.read((char*)&_parent, sizeof(_parent));
+  backup_file.read((char*)&_offspring, sizeof(_offspring));
+  backup_file.read((char*)&_first_child, sizeof(_first_child));
+  backup_file.read((char*)&_last_child, sizeof(_last_child));
+  backup_file.read((char*)&_export_id, sizeof(_export_id));
+  backup_file.read((char*)&_dmu, sizeof(_dmu));
+  backup_file.read((char*)&_dz, sizeof(_dz));
+  backup_file.read((char*)&_Wmu, sizeof(_Wmu));
+  backup_file.read((char*)&_Wz, sizeof(_Wz));
+  backup_file.read((char*)&_EV, sizeof(_EV));
+  backup_file.read((char*)&_EV_contrib, sizeof(_EV_contrib));
+  backup_file.read((char*)&_EV_dot_product, sizeof(_EV_dot_product));
+  backup_file.read((char*)&_r_mu, sizeof(_r_mu));
+  backup_file.read((char*)&_r_sigma, sizeof(_r_sigma));
+  backup_file.read((char*)&_r_theta, sizeof(_r_theta));
 }
 
 /*----------------------------
@@ -95,122 +100,27 @@ Node::~Node( void )
  *----------------------------*/
 
 /**
- * \brief    Add a child
- * \details  --
- * \param    Node* node
- * \return   \e void
- */
-void Node::add_child( Node* node )
-{
-  for (int i = 0; i < (int)_children.size(); i++)
-  {
-    assert(node->get_identifier() != _children[i]->get_identifier());
-  }
-  _children.push_back(node);
-}
-
-/**
- * \brief    Remove a child
+ * \brief    Save the node in a backup file
  * \details  --
- * \param    Node* node
+ * \param    std::ofstream& backup_file
  * \return   \e void
  */
-void Node::remove_child( Node* node )
+void Node::save( std::ofstream& backup_file ) const
 {
-  int pos = -1;
-  for (int i = 0; i < (int)_children.size(); i++)
-  {
-    if (node->get_identifier() == _children[i]->get_identifier() && pos == -1)
-    {
-      pos = (int)i;
-    }
-    else if (node->get_identifier() == _children[i]->get_identifier() && pos >= 0)
-    {
-      printf("Error in Node::remove_child(): multiple occurences of a node in children list. Exit.\n");
-      exit(EXIT_FAILURE);
-    }
-  }
-  if (pos == -1)
-  {
-    printf("Error in Node::remove_child(): node to remove do not exist. Exit.\n");
-    exit(EXIT_FAILURE);
-  }
-  else
-  {
-    _children.erase(_children.begin()+pos);
-  }
+  backup_file.write((char*)&_identifier, sizeof(_identifier));
+  backup_file.write((char*)&_parent, sizeof(_parent));
+  backup_file.write((char*)&_offspring, sizeof(_offspring));
+  backup_file.write((char*)&_first_child, sizeof(_first_child));
+  backup_file.write((char*)&_last_child, sizeof(_last_child));
+  backup_file.write((char*)&_export_id, sizeof(_export_id));
+  backup_file.write((char*)&_dmu, sizeof(_dmu));
+  backup_file.write((char*)&_dz, sizeof(_dz));
+  backup_file.write((char*)&_Wmu, sizeof(_Wmu));
+  backup_file.write((char*)&_Wz, sizeof(_Wz));
+  backup_file.write((char*)&_EV, sizeof(_EV));
+  backup_file.write((char*)&_EV_contrib, sizeof(_EV_contrib));
+  backup_file.write((char*)&_EV_dot_product, sizeof(_EV_dot_product));
+  backup_file.write((char*)&_r_mu, sizeof(_r_mu));
+  backup_file.write((char*)&_r_sigma, sizeof(_r_sigma));
+  backup_file.write((char*)&_r_theta, sizeof(_r_theta));
 }
-
-/**
- * \brief    Replace this child by its own children
- * \details  --
- * \param    Node* node_to_remove
- * \return   \e void
- */
-void Node::replace_children( Node* child_to_remove )
-{
-  /*---------------------------------------*/
-  /* 1) remove the node from children list */
-  /*---------------------------------------*/
-  remove_child(child_to_remove);
-  
-  /*---------------------------------------*/
-  /* 2) add children to the children list  */
-  /*---------------------------------------*/
-  for (int i = 0; i < child_to_remove->get_number_of_children(); i++)
-  {
-    add_child(child_to_remove->get_child(i));
-  }
-}
-
-/**
- * \brief    Tag the lineage of this node
- * \details  --
- * \param    void
- * \return   \e void
- */
-void Node::tag_lineage( void )
-{
-  _tagged = true;
-  Node* node = _parent;
-  while (node != NULL)
-  {
-    node->tag();
-    node = node->get_parent();
-    if (node != NULL)
-    {
-      if (node->isTagged())
-      {
-        node = NULL;
-      }
-    }
-  }
-}
-
-/**
- * \brief    Untag the lineage of this node
- * \details  --
- * \param    void
- * \return   \e void
- */
-void Node::untag_lineage( void )
-{
-  _tagged = false;
-  Node* node = _parent;
-  while (node != NULL)
-  {
-    node->untag();
-    node = node->get_parent();
-    if (node != NULL)
-    {
-      if (!node->isTagged())
-      {
-        node = NULL;
-      }
-    }
-  }
-}
-
-/*----------------------------
- * PROTECTED METHODS
- *----------------------------*/
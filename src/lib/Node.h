@@ -31,7 +31,7 @@
 #define __SigmaFGM__Node__
 
 #include <iostream>
-#include <vector>
+#include <fstream>
 #include <assert.h>
 
 #include "Macros.h"
@@ -48,55 +48,56 @@ public:
    * CONSTRUCTORS
    *----------------------------*/
   Node( void ) = delete;
-  Node( unsigned long long int identifier, int generation );
-  Node( Individual* individual );
-  Node( const Node& node ) = delete;
+  Node( Individual* individual, int parent );
+  Node( std::ifstream& backup_file );
+  Node( const Node& node ) = default;
   
   /*----------------------------
    * DESTRUCTORS
    *----------------------------*/
-  ~Node( void );
+  ~Node( void ) = default;
   
   /*----------------------------
    * GETTERS
    *----------------------------*/
   inline unsigned long long int get_identifier( void ) const;
-  inline int                    get_generation( void ) const;
-  inline Individual*            get_individual( void );
-  inline Node*                  get_parent( void );
-  inline Node*                  get_child( int pos );
-  inline int                    get_number_of_children( void ) const;
-  inline node_class             get_node_class( void ) const;
-  inline node_state             get_node_state( void ) const;
-  inline bool                   isTagged( void ) const;
-  inline bool                   isMasterRoot( void ) const;
+  inline int                    get_parent( void ) const;
   inline bool                   isRoot( void ) const;
-  inline bool                   isNormal( void ) const;
-  inline bool                   isDead( void ) const;
-  inline bool                   isAlive( void ) const;
-  inline bool                   isAncestor( unsigned long long int ancestor_id );
+  inline int                    get_number_of_offspring( void ) const;
+  inline bool                   isReclaimed( void ) const;
+  inline int                    get_first_child( void ) const;
+  inline int                    get_last_child( void ) const;
+  inline bool                   hasMutation( void ) const;
+  inline int                    get_export_identifier( void ) const;
+  inline bool                   isExported( void ) const;
+  inline double                 get_dmu( void ) const;
+  inline double                 get_dz( void ) const;
+  inline double                 get_Wmu( void ) const;
+  inline double                 get_Wz( void ) const;
+  inline double                 get_EV( void ) const;
+  inline double                 get_EV_contribution( void ) const;
+  inline double                 get_EV_dot_product( void ) const;
+  inline double                 get_r_mu( void ) const;
+  inline double                 get_r_sigma( void ) const;
+  inline double                 get_r_theta( void ) const;
+  inline static size_t          get_record_size( void );
   
   /*----------------------------
    * SETTERS
    *----------------------------*/
-  Node& operator=(const Node&) = delete;
+  Node& operator=(const Node&) = default;
   
-  inline void set_parent( Node* node );
-  inline void tag( void );
-  inline void untag( void );
-  inline void set_root( void );
-  inline void set_normal( void );
-  inline void set_dead( void );
-  inline void set_alive( void );
+  inline void set_parent( int parent );
+  inline void add_offspring( int child );
+  inline void set_children( int first_child, int last_child );
+  inline void remove_offspring( void );
+  inline void reclaim( void );
+  inline void set_export_identifier( int export_identifier );
   
   /*----------------------------
    * PUBLIC METHODS
    *----------------------------*/
-  void add_child( Node* node );
-  void remove_child( Node* node );
-  void replace_children( Node* child_to_remove );
-  void tag_lineage( void );
-  void untag_lineage( void );
+  void save( std::ofstream& backup_file ) const;
   
   /*----------------------------
    * PUBLIC ATTRIBUTES
@@ -111,14 +112,28 @@ protected:
   /*----------------------------
    * PROTECTED ATTRIBUTES
    *----------------------------*/
-  unsigned long long int _identifier; /*!< Node's identifier                        */
-  int                    _generation; /*!< Node's generation                        */
-  Individual*            _individual; /*!< Individual                               */
-  Node*                  _parent;     /*!< Parent of the node                       */
-  std::vector<Node*>     _children;   /*!< Children of the node                     */
-  node_class             _node_class; /*!< Node class (master root, root or normal) */
-  node_state             _node_state; /*!< Node state (dead or alive)               */
-  bool                   _tagged;     /*!< Indicates if the node is tagged          */
+  
+  /*----------------------------------------------- GENEALOGY */
+  
+  unsigned long long int _identifier;  /*!< Identifier of the individual                                    */
+  int                    _parent;      /*!< Index of the parent in the previous generation (-1 if root)     */
+  int                    _offspring;   /*!< Number of children in the tree (-1 if the node is reclaimed)    */
+  int                    _first_child; /*!< Index of the first child in the next generation                 */
+  int                    _last_child;  /*!< Index following the last child in the next generation           */
+  int                    _export_id;   /*!< Row of the node in the exported node table (-1 if not exported) */
+  
+  /*----------------------------------------------- REPORTED STATISTICS */
+  
+  double _dmu;            /*!< Mean phenotype distance to the optimum          */
+  double _dz;             /*!< Phenotype distance to the optimum               */
+  double _Wmu;            /*!< Mean phenotype fitness                          */
+  double _Wz;             /*!< Phenotype fitness                               */
+  double _EV;             /*!< Maximum eigenvalue of the covariance matrix     */
+  double _EV_contrib;     /*!< Contribution of the maximum eigenvalue          */
+  double _EV_dot_product; /*!< Alignment of the main eigenvector to the optimum */
+  double _r_mu;           /*!< Mutation size on mu                             */
+  double _r_sigma;        /*!< Mutation size on sigma                          */
+  double _r_theta;        /*!< Mutation size on theta                          */
 };
 
 
@@ -138,167 +153,224 @@ inline unsigned long long int Node::get_identifier( void ) const
 }
 
 /**
- * \brief    Get node's generation
+ * \brief    Get the index of the parent node in the previous generation
+ * \details  Returns -1 if the node is a root
+ * \param    void
+ * \return   \e int
+ */
+inline int Node::get_parent( void ) const
+{
+  return _parent;
+}
+
+/**
+ * \brief    Check if the node is a root or not
  * \details  --
  * \param    void
+ * \return   \e bool
+ */
+inline bool Node::isRoot( void ) const
+{
+  return (_parent == -1);
+}
+
+/**
+ * \brief    Get the number of children of the node in the tree
+ * \details  A dead node without children has no living descendant anymore
+ * \param    void
+ * \return   \e int
+ */
+inline int Node::get_number_of_offspring( void ) const
+{
+  return _offspring;
+}
+
+/**
+ * \brief    Check if the node has been reclaimed
+ * \details  A reclaimed node is a hole in its generation, until the generation is compacted
+ * \param    void
+ * \return   \e bool
+ */
+inline bool Node::isReclaimed( void ) const
+{
+  return (_offspring == -1);
+}
+
+/**
+ * \brief    Get the index of the first child in the next generation
+ * \details  Children of a node are contiguous in the next generation, in the range [first child, last child[
+ *           (reclaimed children included)
+ * \param    void
  * \return   \e int
  */
-inline int Node::get_generation( void ) const
+inline int Node::get_first_child( void ) const
 {
-  return _generation;
+  return _first_child;
 }
 
 /**
- * \brief    Get the individual
+ * \brief    Get the index following the last child in the next generation
  * \details  --
  * \param    void
- * \return   \e Individual*
+ * \return   \e int
  */
-inline Individual* Node::get_individual( void )
+inline int Node::get_last_child( void ) const
 {
-  return _individual;
+  return _last_child;
 }
 
 /**
- * \brief    Get the parent node
+ * \brief    Check if the individual carries a new mutation
  * \details  --
  * \param    void
- * \return   \e Node*
+ * \return   \e bool
  */
-inline Node* Node::get_parent( void )
+inline bool Node::hasMutation( void ) const
 {
-  return _parent;
+  return (_r_mu > 0.0 || _r_sigma > 0.0 || _r_theta > 0.0);
+}
+
+/**
+ * \brief    Get the row of the node in the exported node table
+ * \details  Returns -1 if the node has not been exported yet
+ * \param    void
+ * \return   \e int
+ */
+inline int Node::get_export_identifier( void ) const
+{
+  return _export_id;
 }
 
 /**
- * \brief    Get the child at position 'pos'
+ * \brief    Check if the node has been exported
  * \details  --
- * \param    int pos
- * \return   \e Node*
+ * \param    void
+ * \return   \e bool
  */
-inline Node* Node::get_child( int pos )
+inline bool Node::isExported( void ) const
 {
-  assert(pos < (int)_children.size());
-  return _children[pos];
+  return (_export_id >= 0);
 }
 
 /**
- * \brief    Get the number of children
+ * \brief    Get dmu
  * \details  --
  * \param    void
- * \return   \e int
+ * \return   \e double
  */
-inline int Node::get_number_of_children( void ) const
+inline double Node::get_dmu( void ) const
 {
-  return (int)_children.size();
+  return _dmu;
 }
 
 /**
- * \brief    Get the node class
+ * \brief    Get dz
  * \details  --
  * \param    void
- * \return   \e node_class
+ * \return   \e double
  */
-inline node_class Node::get_node_class( void ) const
+inline double Node::get_dz( void ) const
 {
-  return _node_class;
+  return _dz;
 }
 
 /**
- * \brief    Get the node state
+ * \brief    Get Wmu
  * \details  --
  * \param    void
- * \return   \e node_state
+ * \return   \e double
  */
-inline node_state Node::get_node_state( void ) const
+inline double Node::get_Wmu( void ) const
 {
-  return _node_state;
+  return _Wmu;
 }
 
 /**
- * \brief    Check if the node is tagged or not
+ * \brief    Get Wz
  * \details  --
  * \param    void
- * \return   \e bool
+ * \return   \e double
  */
-inline bool Node::isTagged( void ) const
+inline double Node::get_Wz( void ) const
 {
-  return _tagged;
+  return _Wz;
 }
 
 /**
- * \brief    Check if the node is the master root
+ * \brief    Get the maximum eigenvalue of the covariance matrix
  * \details  --
  * \param    void
- * \return   \e bool
+ * \return   \e double
  */
-inline bool Node::isMasterRoot( void ) const
+inline double Node::get_EV( void ) const
 {
-  return (_node_class == MASTER_ROOT);
+  return _EV;
 }
 
 /**
- * \brief    Check if the node is a root or not
+ * \brief    Get the contribution of the maximum eigenvalue
  * \details  --
  * \param    void
- * \return   \e bool
+ * \return   \e double
  */
-inline bool Node::isRoot( void ) const
+inline double Node::get_EV_contribution( void ) const
 {
-  return (_node_class == ROOT);
+  return _EV_contrib;
 }
 
 /**
- * \brief    Check if the node is normal or not
+ * \brief    Get the alignment of the main eigenvector with the optimum
  * \details  --
  * \param    void
- * \return   \e bool
+ * \return   \e double
  */
-inline bool Node::isNormal( void ) const
+inline double Node::get_EV_dot_product( void ) const
 {
-  return (_node_class == NORMAL);
+  return _EV_dot_product;
 }
 
 /**
- * \brief    Check if the node is dead
+ * \brief    Get the mutation size on mu
  * \details  --
  * \param    void
- * \return   \e bool
+ * \return   \e double
  */
-inline bool Node::isDead( void ) const
+inline double Node::get_r_mu( void ) const
 {
-  return (_node_state == DEAD);
+  return _r_mu;
 }
 
 /**
- * \brief    Check if the node is alive
+ * \brief    Get the mutation size on sigma
  * \details  --
  * \param    void
- * \return   \e bool
+ * \return   \e double
  */
-inline bool Node::isAlive( void ) const
+inline double Node::get_r_sigma( void ) const
 {
-  return (_node_state == ALIVE);
+  return _r_sigma;
 }
 
 /**
- * \brief    Check if the given identifier is an ancestor
+ * \brief    Get the mutation size on theta
  * \details  --
- * \param    unsigned long long int ancestor_id
- * \return   \e bool
+ * \param    void
+ * \return   \e double
  */
-inline bool Node::isAncestor( unsigned long long int ancestor_id )
+inline double Node::get_r_theta( void ) const
 {
-  Node* node = get_parent();
-  while (node != NULL)
-  {
-    if (node->get_identifier() == ancestor_id)
-    {
-      return true;
-    }
-    node = node->get_parent();
-  }
-  return false;
+  return _r_theta;
+}
+
+/**
+ * \brief    Get the size of a node saved in a file
+ * \details  Must follow Node::save()
+ * \param    void
+ * \return   \e size_t
+ */
+inline size_t Node::get_record_size( void )
+{
+  return sizeof(_identifier)+5*sizeof(int)+10*sizeof(double);
 }
 
 /*----------------------------
@@ -306,69 +378,82 @@ inline bool Node::isAncestor( unsigned long long int ancestor_id )
  *----------------------------*/
 
 /**
- * \brief    Add a parent
+ * \brief    Set the index of the parent node in the previous generation
  * \details  --
- * \param    Node* node
+ * \param    int parent
  * \return   \e void
  */
-inline void Node::set_parent( Node* node )
+inline void Node::set_parent( int parent )
 {
-  _parent = node;
+  _parent = parent;
 }
 
 /**
- * \brief    Tag the node
- * \details  --
- * \param    void
+ * \brief    Add a child to the node
+ * \details  Children must be added consecutively in the next generation
+ * \param    int child
  * \return   \e void
  */
-inline void Node::tag( void )
+inline void Node::add_offspring( int child )
 {
-  _tagged = true;
+  assert(_offspring >= 0);
+  if (_offspring == 0)
+  {
+    _first_child = child;
+  }
+  assert(_offspring == 0 || _last_child == child);
+  _last_child = child+1;
+  _offspring++;
 }
 
 /**
- * \brief    Untag the node
+ * \brief    Set the range of children in the next generation
  * \details  --
- * \param    void
+ * \param    int first_child
+ * \param    int last_child
  * \return   \e void
  */
-inline void Node::untag( void )
+inline void Node::set_children( int first_child, int last_child )
 {
-  _tagged = false;
+  assert(first_child <= last_child);
+  _first_child = first_child;
+  _last_child  = last_child;
 }
 
 /**
- * \brief    Set the node class as root
+ * \brief    Remove a child from the node
  * \details  --
  * \param    void
  * \return   \e void
  */
-inline void Node::set_root( void )
+inline void Node::remove_offspring( void )
 {
-  _node_class = ROOT;
+  assert(_offspring > 0);
+  _offspring--;
 }
 
 /**
- * \brief    Set the node class as normal
+ * \brief    Reclaim the node
  * \details  --
  * \param    void
  * \return   \e void
  */
-inline void Node::set_normal( void )
+inline void Node::reclaim( void )
 {
-  _node_class = NORMAL;
+  assert(_offspring == 0);
+  _offspring = -1;
 }
 
 /**
- * \brief    Set the node state dead
+ * \brief    Set the row of the node in the exported node table
  * \details  --
- * \param    void
+ * \param    int export_identifier
  * \return   \e void
  */
-inline void Node::set_dead( void )
+inline void Node::set_export_identifier( int export_identifier )
 {
-  _node_state = DEAD;
+  assert(export_identifier >= 0);
+  _export_id = export_identifier;
 }
 
 
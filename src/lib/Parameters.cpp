@@ -85,6 +85,103 @@ Parameters::Parameters( void )
   /*----------------------------------------------- NOISE PROPERTIES */
   
   _noise_type = NONE;
+  
+  /*----------------------------------------------- ENGINE */
+  
+  _engine = TILED;
+  
+  /*----------------------------------------------- OUTPUTS */
+  
+  _snapshot_interval   = 0;
+  _checkpoint_interval = 0;
+  _resume_filename     = "";
+  _stabilization_cache = "";
+  _output_path         = ".";
+  _lineage_tracking    = false;
+  _lineage_budget      = 0;
+  _lod_depth           = 0;
+  _telemetry_interval  = 0;
+  _file_output         = true;
+  
+  /*----------------------------------------------- COMMAND LINE */
+  
+  _mandatory_arguments = 0;
+  _arguments_error     = "";
+}
+
+/**
+ * \brief    Copy constructor
+ * \details  The pseudorandom numbers generator is cloned, so that the copy owns an independent stream
+ * \param    const Parameters& parameters
+ * \return   \e void
+ */
+Parameters::Parameters( const Parameters& parameters )
+{
+  /*----------------------------------------------- PSEUDORANDOM NUMBERS GENERATOR SEED */
+  
+  _prng = new Prng(*parameters._prng);
+  _seed = parameters._seed;
+  
+  /*----------------------------------------------- SIMULATION TIME */
+  
+  _stabilizing_generations = parameters._stabilizing_generations;
+  _generations             = parameters._generations;
+  _shutoff_distance        = parameters._shutoff_distance;
+  _shutoff_generation      = parameters._shutoff_generation;
+  
+  /*----------------------------------------------- PHENOTYPIC COMPLEXITY */
+  
+  _number_of_dimensions = parameters._number_of_dimensions;
+  
+  /*----------------------------------------------- FITNESS FUNCTION */
+  
+  _alpha = parameters._alpha;
+  _beta  = parameters._beta;
+  _Q     = parameters._Q;
+  
+  /*----------------------------------------------- POPULATION */
+  
+  _population_size = parameters._population_size;
+  _initial_mu      = parameters._initial_mu;
+  _initial_sigma   = parameters._initial_sigma;
+  _initial_theta   = parameters._initial_theta;
+  _oneD_shift      = parameters._oneD_shift;
+  _mean_fitness    = parameters._mean_fitness;
+  
+  /*----------------------------------------------- MUTATIONS */
+  
+  _m_mu    = parameters._m_mu;
+  _m_sigma = parameters._m_sigma;
+  _m_theta = parameters._m_theta;
+  _s_mu    = parameters._s_mu;
+  _s_sigma = parameters._s_sigma;
+  _s_theta = parameters._s_theta;
+  
+  /*----------------------------------------------- NOISE PROPERTIES */
+  
+  _noise_type = parameters._noise_type;
+  
+  /*----------------------------------------------- ENGINE */
+  
+  _engine = parameters._engine;
+  
+  /*----------------------------------------------- OUTPUTS */
+  
+  _snapshot_interval   = parameters._snapshot_interval;
+  _checkpoint_interval = parameters._checkpoint_interval;
+  _resume_filename     = parameters._resume_filename;
+  _stabilization_cache = parameters._stabilization_cache;
+  _output_path         = parameters._output_path;
+  _lineage_tracking    = parameters._lineage_tracking;
+  _lineage_budget      = parameters._lineage_budget;
+  _lod_depth           = parameters._lod_depth;
+  _telemetry_interval  = parameters._telemetry_interval;
+  _file_output         = parameters._file_output;
+  
+  /*----------------------------------------------- COMMAND LINE */
+  
+  _mandatory_arguments = parameters._mandatory_arguments;
+  _arguments_error     = parameters._arguments_error;
 }
 
 /*----------------------------
@@ -141,5 +238,724 @@ void Parameters::print_parameters( void )
   else if (_noise_type == ISOTROPIC) std::cout << "noise type              ISOTROPIC\n";
   else if (_noise_type == UNCORRELATED) std::cout << "noise type              UNCORRELATED\n";
   else if (_noise_type == FULL) std::cout << "noise type              FULL\n";
+  if (_engine == REFERENCE) std::cout << "engine                  REFERENCE\n";
+  else if (_engine == TILED) std::cout << "engine                  TILED\n";
+  std::cout << "snapshot interval       " << _snapshot_interval << "\n";
+  std::cout << "checkpoint interval     " << _checkpoint_interval << "\n";
+  std::cout << "output path             " << _output_path << "\n";
+  std::cout << "lineage tracking        " << _lineage_tracking << "\n";
+  std::cout << "lineage memory budget   " << _lineage_budget << "\n";
+  std::cout << "line of descent depth   " << _lod_depth << "\n";
+  std::cout << "telemetry interval      " << _telemetry_interval << "\n";
   std::cout << "#######################################\n";
 }
+
+/**
+ * \brief    Read the simulation parameters from command line arguments
+ * \details  Unknown arguments are ignored, so that executables can define their own options. Mandatory arguments are
+ *           counted (see has_mandatory_arguments()). Nothing is printed on a wrong argument: the function returns false
+ *           and the error is given by get_arguments_error()
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e bool (false if an argument is wrong)
+ */
+bool Parameters::read_arguments( int argc, char const** argv )
+{
+  int counter = 0;
+  _arguments_error = "";
+  for (int i = 0; i < argc; i++)
+  {
+    /*----------------------------------------------- PSEUDORANDOM NUMBERS GENERATOR SEED */
+    
+    if (strcmp(argv[i], "-seed") == 0 || strcmp(argv[i], "--seed") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_seed((unsigned long int)atoi(argv[i+1]));
+        counter++;
+      }
+    }
+    
+    /*----------------------------------------------- SIMULATION TIME */
+    
+    else if (strcmp(argv[i], "-stabg") == 0 || strcmp(argv[i], "--stabilizing-generations") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_number_of_stabilizing_generations(atoi(argv[i+1]));
+      }
+    }
+    else if (strcmp(argv[i], "-g") == 0 || strcmp(argv[i], "--generations") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_number_of_generations(atoi(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-shutoffd") == 0 || strcmp(argv[i], "--shutoff-distance") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_shutoff_distance(atof(argv[i+1]));
+      }
+    }
+    else if (strcmp(argv[i], "-shutoffg") == 0 || strcmp(argv[i], "--shutoff-generation") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_shutoff_generation(atoi(argv[i+1]));
+      }
+    }
+    
+    /*----------------------------------------------- PHENOTYPIC COMPLEXITY */
+    
+    else if (strcmp(argv[i], "-nbdim") == 0 || strcmp(argv[i], "--nb-dimensions") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_number_of_dimensions(atoi(argv[i+1]));
+        counter++;
+      }
+    }
+    
+    /*----------------------------------------------- FITNESS FUNCTION */
+    
+    else if (strcmp(argv[i], "-alpha") == 0 || strcmp(argv[i], "--alpha") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_alpha(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-beta") == 0 || strcmp(argv[i], "--beta") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_beta(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-Q") == 0 || strcmp(argv[i], "--Q") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_Q(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    
+    /*----------------------------------------------- POPULATION */
+    
+    else if (strcmp(argv[i], "-popsize") == 0 || strcmp(argv[i], "--population-size") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_population_size(atoi(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-initmu") == 0 || strcmp(argv[i], "--initial-mu") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_initial_mu(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-initsigma") == 0 || strcmp(argv[i], "--initial-sigma") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_initial_sigma(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-inittheta") == 0 || strcmp(argv[i], "--initial-theta") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_initial_theta(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-oneDshift") == 0 || strcmp(argv[i], "--oneD-shift") == 0)
+    {
+      set_oneD_shift(true);
+    }
+    else if (strcmp(argv[i], "-meanfitness") == 0 || strcmp(argv[i], "--mean-fitness") == 0)
+    {
+      set_mean_fitness(true);
+    }
+    
+    /*----------------------------------------------- MUTATIONS */
+    
+    else if (strcmp(argv[i], "-mmu") == 0 || strcmp(argv[i], "--m-mu") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_m_mu(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-msigma") == 0 || strcmp(argv[i], "--m-sigma") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_m_sigma(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-mtheta") == 0 || strcmp(argv[i], "--m-theta") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_m_theta(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-smu") == 0 || strcmp(argv[i], "--s-mu") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_s_mu(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-ssigma") == 0 || strcmp(argv[i], "--s-sigma") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_s_sigma(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    else if (strcmp(argv[i], "-stheta") == 0 || strcmp(argv[i], "--s-theta") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_s_theta(atof(argv[i+1]));
+        counter++;
+      }
+    }
+    
+    /*----------------------------------------------- NOISE PROPERTIES */
+    
+    else if (strcmp(argv[i], "-noise") == 0 || strcmp(argv[i], "--noise-type") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        if (strcmp(argv[i+1], "NONE") == 0)
+        {
+          set_noise_type(NONE);
+        }
+        else if (strcmp(argv[i+1], "ISOTROPIC") == 0)
+        {
+          set_noise_type(ISOTROPIC);
+        }
+        else if (strcmp(argv[i+1], "UNCORRELATED") == 0)
+        {
+          set_noise_type(UNCORRELATED);
+        }
+        else if (strcmp(argv[i+1], "FULL") == 0)
+        {
+          set_noise_type(FULL);
+        }
+        else
+        {
+          _arguments_error = std::string("wrong value ")+argv[i+1]+" for parameter -noise (--noise-type)";
+          return false;
+        }
+        counter++;
+      }
+    }
+    
+    /*----------------------------------------------- ENGINE */
+    
+    else if (strcmp(argv[i], "-engine") == 0 || strcmp(argv[i], "--engine") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        if (!read_engine(argv[i+1], _engine))
+        {
+          _arguments_error = std::string("wrong value ")+argv[i+1]+" for parameter -engine (--engine)";
+          return false;
+        }
+      }
+    }
+    
+    /*----------------------------------------------- OUTPUTS */
+    
+    else if (strcmp(argv[i], "-snapshot") == 0 || strcmp(argv[i], "--snapshot-interval") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_snapshot_interval(atoi(argv[i+1]));
+      }
+    }
+    else if (strcmp(argv[i], "-checkpoint") == 0 || strcmp(argv[i], "--checkpoint-interval") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_checkpoint_interval(atoi(argv[i+1]));
+      }
+    }
+    else if (strcmp(argv[i], "-resume") == 0 || strcmp(argv[i], "--resume") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_resume_filename(argv[i+1]);
+      }
+    }
+    else if (strcmp(argv[i], "-stabcache") == 0 || strcmp(argv[i], "--stabilization-cache") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_stabilization_cache(argv[i+1]);
+      }
+    }
+    else if (strcmp(argv[i], "-output") == 0 || strcmp(argv[i], "--output-path") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_output_path(argv[i+1]);
+      }
+    }
+    else if (strcmp(argv[i], "-lineage") == 0 || strcmp(argv[i], "--lineage-tracking") == 0)
+    {
+      set_lineage_tracking(true);
+    }
+    else if (strcmp(argv[i], "-lineage-budget") == 0 || strcmp(argv[i], "--lineage-memory-budget") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_lineage_memory_budget(atoi(argv[i+1]));
+      }
+    }
+    else if (strcmp(argv[i], "-lod") == 0 || strcmp(argv[i], "--line-of-descent") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_line_of_descent_depth(atoi(argv[i+1]));
+      }
+    }
+    else if (strcmp(argv[i], "-telemetry") == 0 || strcmp(argv[i], "--telemetry") == 0)
+    {
+      if (i+1 == argc)
+      {
+        _arguments_error = std::string("value of ")+argv[i]+" is missing";
+        return false;
+      }
+      else
+      {
+        set_telemetry_interval(atoi(argv[i+1]));
+      }
+    }
+    
+  }
+  _mandatory_arguments = counter;
+  return true;
+}
+
+/**
+ * \brief    Read the name of a generation engine
+ * \details  Names are the values of -engine (REFERENCE/TILED). engine is left unchanged if the name is unknown
+ * \param    std::string name
+ * \param    type_of_engine& engine
+ * \return   \e bool (false if the name is unknown)
+ */
+bool Parameters::read_engine( std::string name, type_of_engine& engine )
+{
+  if (name == "REFERENCE")
+  {
+    engine = REFERENCE;
+    return true;
+  }
+  else if (name == "TILED")
+  {
+    engine = TILED;
+    return true;
+  }
+  return false;
+}
+
+/**
+ * \brief    Print the usage of simulation parameters
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void Parameters::print_arguments_usage( void )
+{
+  std::cout << "  -seed, --seed\n";
+  std::cout << "        specify the prng seed (mandatory, random if 0)\n";
+  std::cout << "  -stabg, --stabilizing-generations\n";
+  std::cout << "        specify the number of stabilizing generations\n";
+  std::cout << "  -g, --generations\n";
+  std::cout << "        specify the number of generations (mandatory)\n";
+  std::cout << "  -shutoffd, --shutoff-distance\n";
+  std::cout << "        specify the shutoff distance\n";
+  std::cout << "  -shutoffg, --shutoff-generation\n";
+  std::cout << "        specify the shutoff generation\n";
+  std::cout << "  -nbdim, --nb-dimensions\n";
+  std::cout << "        specify the number of dimensions (mandatory)\n";
+  std::cout << "  -alpha, --alpha\n";
+  std::cout << "        specify the alpha parameter of the fitness function (0.0 < mandatory)\n";
+  std::cout << "  -beta, --beta\n";
+  std::cout << "        specify the beta parameter of the fitness function (0.0 <= mandatory <= 1.0)\n";
+  std::cout << "  -Q, --Q\n";
+  std::cout << "        specify the Q parameter of the fitness function (0.0 <= mandatory)\n";
+  std::cout << "  -popsize, --population-size\n";
+  std::cout << "        specify the population size (mandatory)\n";
+  std::cout << "  -initmu, --initial-mu\n";
+  std::cout << "        specify the initial mu value (mandatory)\n";
+  std::cout << "  -initsigma, --initial-sigma\n";
+  std::cout << "        specify initial sigma value (mandatory)\n";
+  std::cout << "  -inittheta, --initial-theta\n";
+  std::cout << "        specify initial theta value (mandatory)\n";
+  std::cout << "  -oneDshift, --oneD-shift\n";
+  std::cout << "        Indicates if the initial population is shifted in a single dimension\n";
+  std::cout << "  -meanfitness, --mean-fitness\n";
+  std::cout << "        Indicates if the mean fitness should be computed (by sampling the phenotypes)\n";
+  std::cout << "  -mmu, --m-mu\n";
+  std::cout << "        specify mu mutation rate (mandatory)\n";
+  std::cout << "  -msigma, --m-sigma\n";
+  std::cout << "        specify sigma mutation rate (mandatory)\n";
+  std::cout << "  -mtheta, --m-theta\n";
+  std::cout << "        specify theta mutation rate (mandatory)\n";
+  std::cout << "  -smu, --s-mu\n";
+  std::cout << "        specify mu mutation size (mandatory)\n";
+  std::cout << "  -ssigma, --s-sigma\n";
+  std::cout << "        specify sigma mutation size (mandatory)\n";
+  std::cout << "  -stheta, --stheta\n";
+  std::cout << "        specify theta mutation size (mandatory)\n";
+  std::cout << "  -noise, --noise-type\n";
+  std::cout << "        Specify the type of noise (mandatory, NONE/ISOTROPIC/UNCORRELATED/FULL)\n";
+  std::cout << "  -engine, --engine\n";
+  std::cout << "        Specify the generation engine (REFERENCE/TILED, TILED by default, both give identical results)\n";
+  std::cout << "  -snapshot, --snapshot-interval\n";
+  std::cout << "        specify the number of generations between binary population snapshots (0 if none)\n";
+  std::cout << "  -checkpoint, --checkpoint-interval\n";
+  std::cout << "        specify the number of generations between checkpoints (0 if none, a checkpoint is always saved on SIGTERM)\n";
+  std::cout << "  -resume, --resume\n";
+  std::cout << "        resume the simulation from a checkpoint file (other parameters must be identical)\n";
+  std::cout << "  -stabcache, --stabilization-cache\n";
+  std::cout << "        specify a directory where stabilized populations are cached and reused by runs sharing the same seed and parameters\n";
+  std::cout << "  -output, --output-path\n";
+  std::cout << "        specify the directory of output files (current directory by default)\n";
+  std::cout << "  -lineage, --lineage-tracking\n";
+  std::cout << "        Indicates if the lineage of the population is tracked (the best lineage is written in best_lineage.txt)\n";
+  std::cout << "  -lineage-budget, --lineage-memory-budget\n";
+  std::cout << "        specify the memory budget of the lineage tree in MB (ancestors of the MRCA are moved to disk above it, 0 if unlimited)\n";
+  std::cout << "  -lod, --line-of-descent\n";
+  std::cout << "        specify the number of generations of history kept to write the line of descent of the best individual (0 if none)\n";
+  std::cout << "  -telemetry, --telemetry\n";
+  std::cout << "        specify the number of generations between throughput reports written in telemetry.txt (0 if none)\n";
+}
+
+/**
+ * \brief    Save the parameters defining the model in a checkpoint
+ * \details  Simulation time and output parameters are not saved, so that a resumed simulation can be extended
+ * \param    std::ofstream& backup_file
+ * \return   \e void
+ */
+void Parameters::save( std::ofstream& backup_file ) const
+{
+  int noise_type = (int)_noise_type;
+  backup_file.write((char*)&_stabilizing_generations, sizeof(_stabilizing_generations));
+  backup_file.write((char*)&_number_of_dimensions, sizeof(_number_of_dimensions));
+  backup_file.write((char*)&_alpha, sizeof(_alpha));
+  backup_file.write((char*)&_beta, sizeof(_beta));
+  backup_file.write((char*)&_Q, sizeof(_Q));
+  backup_file.write((char*)&_population_size, sizeof(_population_size));
+  backup_file.write((char*)&_initial_mu, sizeof(_initial_mu));
+  backup_file.write((char*)&_initial_sigma, sizeof(_initial_sigma));
+  backup_file.write((char*)&_initial_theta, sizeof(_initial_theta));
+  backup_file.write((char*)&_oneD_shift, sizeof(_oneD_shift));
+  backup_file.write((char*)&_mean_fitness, sizeof(_mean_fitness));
+  backup_file.write((char*)&_m_mu, sizeof(_m_mu));
+  backup_file.write((char*)&_m_sigma, sizeof(_m_sigma));
+  backup_file.write((char*)&_m_theta, sizeof(_m_theta));
+  backup_file.write((char*)&_s_mu, sizeof(_s_mu));
+  backup_file.write((char*)&_s_sigma, sizeof(_s_sigma));
+  backup_file.write((char*)&_s_theta, sizeof(_s_theta));
+  backup_file.write((char*)&noise_type, sizeof(noise_type));
+}
+
+/**
+ * \brief    Check that the parameters saved in a checkpoint match the current parameters
+ * \details  Returns false and describes the problem in error if any parameter defining the model differs
+ * \param    std::ifstream& backup_file
+ * \param    std::string& error
+ * \return   \e bool
+ */
+bool Parameters::check_backup( std::ifstream& backup_file, std::string& error ) const
+{
+  int    stabilizing_generations = 0;
+  int    number_of_dimensions    = 0;
+  double alpha                   = 0.0;
+  double beta                    = 0.0;
+  double Q                       = 0.0;
+  int    population_size         = 0;
+  double initial_mu              = 0.0;
+  double initial_sigma           = 0.0;
+  double initial_theta           = 0.0;
+  bool   oneD_shift              = false;
+  bool   mean_fitness            = false;
+  double m_mu                    = 0.0;
+  double m_sigma                 = 0.0;
+  double m_theta                 = 0.0;
+  double s_mu                    = 0.0;
+  double s_sigma                 = 0.0;
+  double s_theta                 = 0.0;
+  int    noise_type              = 0;
+  backup_file.read((char*)&stabilizing_generations, sizeof(stabilizing_generations));
+  backup_file.read((char*)&number_of_dimensions, sizeof(number_of_dimensions));
+  backup_file.read((char*)&alpha, sizeof(alpha));
+  backup_file.read((char*)&beta, sizeof(beta));
+  backup_file.read((char*)&Q, sizeof(Q));
+  backup_file.read((char*)&population_size, sizeof(population_size));
+  backup_file.read((char*)&initial_mu, sizeof(initial_mu));
+  backup_file.read((char*)&initial_sigma, sizeof(initial_sigma));
+  backup_file.read((char*)&initial_theta, sizeof(initial_theta));
+  backup_file.read((char*)&oneD_shift, sizeof(oneD_shift));
+  backup_file.read((char*)&mean_fitness, sizeof(mean_fitness));
+  backup_file.read((char*)&m_mu, sizeof(m_mu));
+  backup_file.read((char*)&m_sigma, sizeof(m_sigma));
+  backup_file.read((char*)&m_theta, sizeof(m_theta));
+  backup_file.read((char*)&s_mu, sizeof(s_mu));
+  backup_file.read((char*)&s_sigma, sizeof(s_sigma));
+  backup_file.read((char*)&s_theta, sizeof(s_theta));
+  backup_file.read((char*)&noise_type, sizeof(noise_type));
+  if (!backup_file)
+  {
+    error = "the checkpoint file is truncated";
+    return false;
+  }
+  if (stabilizing_generations != _stabilizing_generations || number_of_dimensions != _number_of_dimensions ||
+      alpha != _alpha || beta != _beta || Q != _Q ||
+      population_size != _population_size || initial_mu != _initial_mu || initial_sigma != _initial_sigma || initial_theta != _initial_theta ||
+      oneD_shift != _oneD_shift || mean_fitness != _mean_fitness ||
+      m_mu != _m_mu || m_sigma != _m_sigma || m_theta != _m_theta ||
+      s_mu != _s_mu || s_sigma != _s_sigma || s_theta != _s_theta ||
+      noise_type != (int)_noise_type)
+  {
+    error = "the checkpoint was created with different parameters";
+    return false;
+  }
+  return true;
+}
+
+/**
+ * \brief    Compute the key of the stabilized population in the cache
+ * \details  FNV-1a hash of the seed and of all the parameters acting on the stabilization phase
+ * \param    void
+ * \return   \e unsigned long long int
+ */
+unsigned long long int Parameters::compute_stabilization_key( void ) const
+{
+  unsigned long long int key        = 14695981039346656037ULL;
+  int                    noise_type = (int)_noise_type;
+  unsigned int           version    = CHECKPOINT_VERSION;
+  hash(key, &version, sizeof(version));
+  hash(key, &_seed, sizeof(_seed));
+  hash(key, &_stabilizing_generations, sizeof(_stabilizing_generations));
+  hash(key, &_number_of_dimensions, sizeof(_number_of_dimensions));
+  hash(key, &_alpha, sizeof(_alpha));
+  hash(key, &_beta, sizeof(_beta));
+  hash(key, &_Q, sizeof(_Q));
+  hash(key, &_population_size, sizeof(_population_size));
+  hash(key, &_initial_mu, sizeof(_initial_mu));
+  hash(key, &_initial_sigma, sizeof(_initial_sigma));
+  hash(key, &_initial_theta, sizeof(_initial_theta));
+  hash(key, &_oneD_shift, sizeof(_oneD_shift));
+  hash(key, &_mean_fitness, sizeof(_mean_fitness));
+  hash(key, &_m_mu, sizeof(_m_mu));
+  hash(key, &_m_sigma, sizeof(_m_sigma));
+  hash(key, &_m_theta, sizeof(_m_theta));
+  hash(key, &_s_mu, sizeof(_s_mu));
+  hash(key, &_s_sigma, sizeof(_s_sigma));
+  hash(key, &_s_theta, sizeof(_s_theta));
+  hash(key, &noise_type, sizeof(noise_type));
+  return key;
+}
+
+/**
+ * \brief    Get the file of the stabilized population in the cache
+ * \details  Returns an empty string if no cache is used or if there is no stabilization phase
+ * \param    void
+ * \return   \e std::string
+ */
+std::string Parameters::get_stabilization_cache_filename( void ) const
+{
+  if (_stabilization_cache == "" || _stabilizing_generations == 0)
+  {
+    return "";
+  }
+  std::stringstream filename;
+  filename << _stabilization_cache << "/stabilization_" << std::hex << std::setw(16) << std::setfill('0') << compute_stabilization_key() << ".bin";
+  return filename.str();
+}
+
+/*----------------------------
+ * PROTECTED METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Update a FNV-1a hash key with a block of data
+ * \details  --
+ * \param    unsigned long long int& key
+ * \param    const void* data
+ * \param    size_t size
+ * \return   \e void
+ */
+void Parameters::hash( unsigned long long int& key, const void* data, size_t size ) const
+{
+  const unsigned char* bytes = (const unsigned char*)data;
+  for (size_t i = 0; i < size; i++)
+  {
+    key ^= (unsigned long long int)bytes[i];
+    key *= 1099511628211ULL;
+  }
+}
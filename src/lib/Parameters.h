@@ -31,6 +31,11 @@
 #define __SigmaFGM__Parameters__
 
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <cstring>
 #include <vector>
 #include <assert.h>
 
@@ -48,7 +53,7 @@ public:
    * CONSTRUCTORS
    *----------------------------*/
   Parameters( void );
-  Parameters( const Parameters& parameters ) = delete;
+  Parameters( const Parameters& parameters );
   
   /*----------------------------
    * DESTRUCTORS
@@ -103,6 +108,29 @@ public:
   
   inline type_of_noise get_noise_type( void ) const;
   
+  /*----------------------------------------------- ENGINE */
+  
+  inline type_of_engine get_engine( void ) const;
+  
+  /*----------------------------------------------- OUTPUTS */
+  
+  inline int         get_snapshot_interval( void ) const;
+  inline int         get_checkpoint_interval( void ) const;
+  inline std::string get_resume_filename( void ) const;
+  inline std::string get_stabilization_cache( void ) const;
+  inline std::string get_output_path( void ) const;
+  inline std::string get_output_filename( std::string filename ) const;
+  inline bool        get_lineage_tracking( void ) const;
+  inline int         get_lineage_memory_budget( void ) const;
+  inline int         get_line_of_descent_depth( void ) const;
+  inline int         get_telemetry_interval( void ) const;
+  inline bool        get_file_output( void ) const;
+  
+  /*----------------------------------------------- COMMAND LINE */
+  
+  inline bool        has_mandatory_arguments( void ) const;
+  inline std::string get_arguments_error( void ) const;
+  
   /*----------------------------
    * SETTERS
    *----------------------------*/
@@ -152,10 +180,37 @@ public:
   
   inline void set_noise_type( type_of_noise noise_type );
   
+  /*----------------------------------------------- ENGINE */
+  
+  inline void set_engine( type_of_engine engine );
+  
+  /*----------------------------------------------- OUTPUTS */
+  
+  inline void set_snapshot_interval( int snapshot_interval );
+  inline void set_checkpoint_interval( int checkpoint_interval );
+  inline void set_resume_filename( std::string resume_filename );
+  inline void set_stabilization_cache( std::string stabilization_cache );
+  inline void set_output_path( std::string output_path );
+  inline void set_lineage_tracking( bool lineage_tracking );
+  inline void set_lineage_memory_budget( int lineage_memory_budget );
+  inline void set_line_of_descent_depth( int line_of_descent_depth );
+  inline void set_telemetry_interval( int telemetry_interval );
+  inline void set_file_output( bool file_output );
+  
   /*----------------------------
    * PUBLIC METHODS
    *----------------------------*/
   void print_parameters( void );
+  bool read_arguments( int argc, char const** argv );
+  
+  static bool read_engine( std::string name, type_of_engine& engine );
+  static void print_arguments_usage( void );
+  
+  void save( std::ofstream& backup_file ) const;
+  bool check_backup( std::ifstream& backup_file, std::string& error ) const;
+  
+  unsigned long long int compute_stabilization_key( void ) const;
+  std::string            get_stabilization_cache_filename( void ) const;
   
   /*----------------------------
    * PUBLIC ATTRIBUTES
@@ -166,6 +221,7 @@ protected:
   /*----------------------------
    * PROTECTED METHODS
    *----------------------------*/
+  void hash( unsigned long long int& key, const void* data, size_t size ) const;
   
   /*----------------------------
    * PROTECTED ATTRIBUTES
@@ -215,6 +271,28 @@ protected:
   
   type_of_noise _noise_type; /*!< Type of phenotypic noise (none, isotropic, ...) */
   
+  /*----------------------------------------------- ENGINE */
+  
+  type_of_engine _engine; /*!< Generation engine (reference or tiled) */
+  
+  /*----------------------------------------------- OUTPUTS */
+  
+  int         _snapshot_interval;   /*!< Number of generations between population snapshots (0 if none) */
+  int         _checkpoint_interval; /*!< Number of generations between checkpoints (0 if none)          */
+  std::string _resume_filename;     /*!< Checkpoint file to resume from (empty if none)                 */
+  std::string _stabilization_cache; /*!< Stabilized populations cache directory (empty if none)         */
+  std::string _output_path;         /*!< Directory of simulation output files                           */
+  bool        _lineage_tracking;    /*!< Indicates if the lineage of the population is tracked          */
+  int         _lineage_budget;      /*!< Memory budget of the lineage tree in MB (0 if unlimited)       */
+  int         _lod_depth;           /*!< Number of generations of line of descent history (0 if none)   */
+  int         _telemetry_interval;  /*!< Number of generations between telemetry reports (0 if none)    */
+  bool        _file_output;         /*!< Statistic files are written in the output path                 */
+  
+  /*----------------------------------------------- COMMAND LINE */
+  
+  int         _mandatory_arguments; /*!< Number of mandatory arguments read from the command line */
+  std::string _arguments_error;     /*!< Error of the last command line read (empty if none)      */
+  
 };
 
 
@@ -490,6 +568,166 @@ inline type_of_noise Parameters::get_noise_type( void ) const
   return _noise_type;
 }
 
+/*----------------------------------------------- ENGINE */
+
+/**
+ * \brief    Get the generation engine
+ * \details  --
+ * \param    void
+ * \return   \e type_of_engine
+ */
+inline type_of_engine Parameters::get_engine( void ) const
+{
+  return _engine;
+}
+
+/*----------------------------------------------- OUTPUTS */
+
+/**
+ * \brief    Get the population snapshot interval
+ * \details  --
+ * \param    void
+ * \return   \e int
+ */
+inline int Parameters::get_snapshot_interval( void ) const
+{
+  return _snapshot_interval;
+}
+
+/**
+ * \brief    Get the checkpoint interval
+ * \details  --
+ * \param    void
+ * \return   \e int
+ */
+inline int Parameters::get_checkpoint_interval( void ) const
+{
+  return _checkpoint_interval;
+}
+
+/**
+ * \brief    Get the checkpoint file to resume from
+ * \details  Returns an empty string if the simulation is not resumed
+ * \param    void
+ * \return   \e std::string
+ */
+inline std::string Parameters::get_resume_filename( void ) const
+{
+  return _resume_filename;
+}
+
+/**
+ * \brief    Get the stabilized populations cache directory
+ * \details  Returns an empty string if no cache is used
+ * \param    void
+ * \return   \e std::string
+ */
+inline std::string Parameters::get_stabilization_cache( void ) const
+{
+  return _stabilization_cache;
+}
+
+/**
+ * \brief    Get the directory of simulation output files
+ * \details  --
+ * \param    void
+ * \return   \e std::string
+ */
+inline std::string Parameters::get_output_path( void ) const
+{
+  return _output_path;
+}
+
+/**
+ * \brief    Get the full name of an output file
+ * \details  The file is located in the output path
+ * \param    std::string filename
+ * \return   \e std::string
+ */
+inline std::string Parameters::get_output_filename( std::string filename ) const
+{
+  return _output_path+"/"+filename;
+}
+
+/**
+ * \brief    Get the lineage tracking boolean
+ * \details  --
+ * \param    void
+ * \return   \e bool
+ */
+inline bool Parameters::get_lineage_tracking( void ) const
+{
+  return _lineage_tracking;
+}
+
+/**
+ * \brief    Get the memory budget of the lineage tree
+ * \details  In MB. Returns 0 if the memory is unlimited
+ * \param    void
+ * \return   \e int
+ */
+inline int Parameters::get_lineage_memory_budget( void ) const
+{
+  return _lineage_budget;
+}
+
+/**
+ * \brief    Get the number of generations of line of descent history
+ * \details  Returns 0 if the line of descent is not recorded
+ * \param    void
+ * \return   \e int
+ */
+inline int Parameters::get_line_of_descent_depth( void ) const
+{
+  return _lod_depth;
+}
+
+/**
+ * \brief    Get the number of generations between telemetry reports
+ * \details  Returns 0 if the telemetry is off
+ * \param    void
+ * \return   \e int
+ */
+inline int Parameters::get_telemetry_interval( void ) const
+{
+  return _telemetry_interval;
+}
+
+/**
+ * \brief    Check if statistic files are written
+ * \details  Embedded simulations (see SigmaFGM_api.h) read the statistics in memory instead
+ * \param    void
+ * \return   \e bool
+ */
+inline bool Parameters::get_file_output( void ) const
+{
+  return _file_output;
+}
+
+/*----------------------------------------------- COMMAND LINE */
+
+/**
+ * \brief    Check if all the mandatory arguments were given on the command line
+ * \details  --
+ * \param    void
+ * \return   \e bool
+ */
+inline bool Parameters::has_mandatory_arguments( void ) const
+{
+  return (_mandatory_arguments >= MANDATORY_ARGS);
+}
+
+/**
+ * \brief    Get the error of the last command line read
+ * \details  Empty if the arguments were read without error
+ * \param    void
+ * \return   \e std::string
+ */
+inline std::string Parameters::get_arguments_error( void ) const
+{
+  return _arguments_error;
+}
+
 /*----------------------------
  * SETTERS
  *----------------------------*/
@@ -783,5 +1021,136 @@ inline void Parameters::set_noise_type( type_of_noise noise_type )
   _noise_type = noise_type;
 }
 
+/*----------------------------------------------- ENGINE */
+
+/**
+ * \brief    Set the generation engine
+ * \details  Engines only differ in speed, and are not saved in checkpoints
+ * \param    type_of_engine engine
+ * \return   \e void
+ */
+inline void Parameters::set_engine( type_of_engine engine )
+{
+  _engine = engine;
+}
+
+/*----------------------------------------------- OUTPUTS */
+
+/**
+ * \brief    Set the population snapshot interval
+ * \details  --
+ * \param    int snapshot_interval
+ * \return   \e void
+ */
+inline void Parameters::set_snapshot_interval( int snapshot_interval )
+{
+  assert(snapshot_interval >= 0);
+  _snapshot_interval = snapshot_interval;
+}
+
+/**
+ * \brief    Set the checkpoint interval
+ * \details  --
+ * \param    int checkpoint_interval
+ * \return   \e void
+ */
+inline void Parameters::set_checkpoint_interval( int checkpoint_interval )
+{
+  assert(checkpoint_interval >= 0);
+  _checkpoint_interval = checkpoint_interval;
+}
+
+/**
+ * \brief    Set the checkpoint file to resume from
+ * \details  --
+ * \param    std::string resume_filename
+ * \return   \e void
+ */
+inline void Parameters::set_resume_filename( std::string resume_filename )
+{
+  _resume_filename = resume_filename;
+}
+
+/**
+ * \brief    Set the stabilized populations cache directory
+ * \details  --
+ * \param    std::string stabilization_cache
+ * \return   \e void
+ */
+inline void Parameters::set_stabilization_cache( std::string stabilization_cache )
+{
+  _stabilization_cache = stabilization_cache;
+}
+
+/**
+ * \brief    Set the directory of simulation output files
+ * \details  --
+ * \param    std::string output_path
+ * \return   \e void
+ */
+inline void Parameters::set_output_path( std::string output_path )
+{
+  assert(output_path != "");
+  _output_path = output_path;
+}
+
+/**
+ * \brief    Set the lineage tracking boolean
+ * \details  --
+ * \param    bool lineage_tracking
+ * \return   \e void
+ */
+inline void Parameters::set_lineage_tracking( bool lineage_tracking )
+{
+  _lineage_tracking = lineage_tracking;
+}
+
+/**
+ * \brief    Set the memory budget of the lineage tree
+ * \details  In MB (0 if unlimited)
+ * \param    int lineage_memory_budget
+ * \return   \e void
+ */
+inline void Parameters::set_lineage_memory_budget( int lineage_memory_budget )
+{
+  assert(lineage_memory_budget >= 0);
+  _lineage_budget = lineage_memory_budget;
+}
+
+/**
+ * \brief    Set the number of generations of line of descent history
+ * \details  --
+ * \param    int line_of_descent_depth
+ * \return   \e void
+ */
+inline void Parameters::set_line_of_descent_depth( int line_of_descent_depth )
+{
+  assert(line_of_descent_depth >= 0);
+  _lod_depth = line_of_descent_depth;
+}
+
+/**
+ * \brief    Set the number of generations between telemetry reports
+ * \details  --
+ * \param    int telemetry_interval
+ * \return   \e void
+ */
+inline void Parameters::set_telemetry_interval( int telemetry_interval )
+{
+  assert(telemetry_interval >= 0);
+  _telemetry_interval = telemetry_interval;
+}
+
+/**
+ * \brief    Set if statistic files are written
+ * \details  --
+ * \param    bool file_output
+ * \return   \e void
+ */
+inline void Parameters::set_file_output( bool file_output )
+{
+  _file_output = file_output;
+}
+
 
 #endif /* defined(__SigmaFGM__Parameters__) */
@@ -39,10 +39,9 @@
  * \details  --
  * \param    Parameters* parameters
  * \param    Environment* environment
- * \param    Tree* tree
  * \return   \e void
  */
-Population::Population( Parameters* parameters, Environment* environment, Tree* tree )
+Population::Population( Parameters* parameters, Environment* environment )
 {
   assert(parameters != NULL);
   assert(environment != NULL);
@@ -52,7 +51,9 @@ Population::Population( Parameters* parameters, Environment* environment, Tree*
   _parameters         = parameters;
   _prng               = _parameters->get_prng();
   _environment        = environment;
-  _tree               = tree;
+  _tree               = NULL;
+  _lod                = NULL;
+  _telemetry          = NULL;
   _current_identifier = 1;
   
   /*----------------------------------------------- POPULATION */
@@ -60,8 +61,6 @@ Population::Population( Parameters* parameters, Environment* environment, Tree*
   _pop          = new Individual*[_parameters->get_population_size()];
   _w            = new double[_parameters->get_population_size()];
   _w_sum        = 0.0;
-  int    best   = 0;
-  double best_w = 0.0;
   for (int i = 0; i < _parameters->get_population_size(); i++)
   {
     _pop[i] = new Individual(_prng, _parameters->get_number_of_dimensions(), _parameters->get_initial_mu(), _parameters->get_initial_sigma(), _parameters->get_initial_theta(), _parameters->get_oneD_shift(), _parameters->get_noise_type(), _environment->get_z_opt());
@@ -71,28 +70,56 @@ Population::Population( Parameters* parameters, Environment* environment, Tree*
     if (!_parameters->get_mean_fitness())
     {
       _pop[i]->compute_fitness(_parameters->get_alpha(), _parameters->get_beta(), _parameters->get_Q());
+      _pop[i]->compute_mu_fitness(_parameters->get_alpha(), _parameters->get_beta(), _parameters->get_Q());
     }
     else
     {
       _pop[i]->compute_mean_fitness(_parameters->get_alpha(), _parameters->get_beta(), _parameters->get_Q());
     }
-    //_tree->add_root(_pop[i]);
     _w[i]   = _pop[i]->get_Wz();
     _w_sum += _w[i];
-    if (best_w < _w[i])
-    {
-      best_w = _w[i];
-      best   = i;
-    }
   }
   for (int i = 0; i < _parameters->get_population_size(); i++)
   {
     _w[i] /= _w_sum;
   }
-  //_tree->prune();
-  //_pop[best]->write_mu(0);
-  //_pop[best]->write_sigma(0);
-  //_pop[best]->write_theta(0);
+  allocate_generation_buffers();
+}
+
+/**
+ * \brief    Constructor from backup file
+ * \details  --
+ * \param    Parameters* parameters
+ * \param    Environment* environment
+ * \param    std::ifstream& backup_file
+ * \return   \e void
+ */
+Population::Population( Parameters* parameters, Environment* environment, std::ifstream& backup_file )
+{
+  assert(parameters != NULL);
+  assert(environment != NULL);
+  
+  /*----------------------------------------------- PARAMETERS */
+  
+  _parameters  = parameters;
+  _prng        = _parameters->get_prng();
+  _environment = environment;
+  _tree        = NULL;
+  _lod         = NULL;
+  _telemetry   = NULL;
+  backup_file.read((char*)&_current_identifier, sizeof(_current_identifier));
+  
+  /*----------------------------------------------- POPULATION */
+  
+  _pop = new Individual*[_parameters->get_population_size()];
+  _w   = new double[_parameters->get_population_size()];
+  backup_file.read((char*)&_w_sum, sizeof(_w_sum));
+  backup_file.read((char*)_w, sizeof(double)*_parameters->get_population_size());
+  for (int i = 0; i < _parameters->get_population_size(); i++)
+  {
+    _pop[i] = new Individual(_prng, _environment->get_z_opt(), backup_file);
+  }
+  allocate_generation_buffers();
 }
 
 /*----------------------------
@@ -110,6 +137,8 @@ Population::~Population( void )
   _prng        = NULL;
   _environment = NULL;
   _tree        = NULL;
+  _lod         = NULL;
+  _telemetry   = NULL;
   for (int i = 0; i < _parameters->get_population_size(); i++)
   {
     delete _pop[i];
@@ -119,6 +148,12 @@ Population::~Population( void )
   _pop = NULL;
   delete[] _w;
   _w = NULL;
+  delete[] _next_pop;
+  _next_pop = NULL;
+  delete[] _draws;
+  _draws = NULL;
+  delete[] _parents;
+  _parents = NULL;
   _parameters = NULL;
 }
 
@@ -127,65 +162,234 @@ Population::~Population( void )
  *----------------------------*/
 
 /**
- * \brief    Compute the next generation
- * \details  --
+ * \brief    Start the computation of the next generation
+ * \details  Draws the number of offspring of each parent, and releases the parents without offspring. Offspring are then
+ *           computed by compute_offspring(), in any number of consecutive ranges, and the generation is completed by
+ *           end_generation()
  * \param    int next_generation
  * \return   \e void
  */
-void Population::compute_next_generation( int next_generation )
+void Population::begin_generation( int next_generation )
 {
-  Individual**  new_pop   = new Individual*[_parameters->get_population_size()];
-  unsigned int* draws     = new unsigned int[_parameters->get_population_size()];
-  int           new_index = 0;
-  _w_sum                  = 0.0;
-  int    best             = 0;
-  double best_w           = 0.0;
-  _prng->multinomial(draws, _w, _parameters->get_population_size(), _parameters->get_population_size());
+  INSTRUMENT_SCOPE(TRACE_REPRODUCTION);
+  double time      = (_telemetry != NULL ? _telemetry->get_time() : 0.0);
+  int    new_index = 0;
+  _next_generation = next_generation;
+  _w_sum           = 0.0;
+  {
+    INSTRUMENT_SCOPE(TRACE_RESAMPLING);
+    _prng->multinomial(_draws, _w, _parameters->get_population_size(), _parameters->get_population_size());
+  }
+  if (_tree != NULL)
+  {
+    _tree->new_generation();
+  }
+  if (_lod != NULL)
+  {
+    _lod->new_generation();
+  }
   for (int i = 0; i < _parameters->get_population_size(); i++)
   {
-    for (unsigned int j = 0; j < draws[i]; j++)
+    for (unsigned int j = 0; j < _draws[i]; j++)
     {
-      new_pop[new_index] = new Individual(*_pop[i]);
-      new_pop[new_index]->mutate(_parameters->get_m_mu(), _parameters->get_m_sigma(), _parameters->get_m_theta(), _parameters->get_s_mu(), _parameters->get_s_sigma(), _parameters->get_s_theta());
-      new_pop[new_index]->set_identifier(_current_identifier++);
-      new_pop[new_index]->set_generation(next_generation);
-      new_pop[new_index]->build_phenotype();
-      if (!_parameters->get_mean_fitness())
-      {
-        _pop[i]->compute_fitness(_parameters->get_alpha(), _parameters->get_beta(), _parameters->get_Q());
-      }
-      else
-      {
-        _pop[i]->compute_mean_fitness(_parameters->get_alpha(), _parameters->get_beta(), _parameters->get_Q());
-      }
-      //_tree->add_reproduction_event(_pop[i], new_pop[new_index]);
-      _w[new_index]  = _pop[i]->get_Wz();
-      _w_sum        += _w[new_index];
-      if (best_w < _w[new_index])
+      _parents[new_index] = i;
+      new_index++;
+    }
+    if (_draws[i] == 0)
+    {
+      delete _pop[i];
+      _pop[i] = NULL;
+    }
+  }
+  if (_telemetry != NULL)
+  {
+    _telemetry->add_reproduction_time(time);
+  }
+}
+
+/**
+ * \brief    Compute the offspring first to last-1 of the next generation
+ * \details  Each offspring is copied from its parent, mutated, and its phenotype is built. Ranges must be consecutive and
+ *           cover the whole population, since a parent is released with its last offspring. The next offspring inherits
+ *           the fitness of the parent's mean phenotype, which is thus only computed when the parent has one left
+ * \param    int first
+ * \param    int last
+ * \return   \e void
+ */
+void Population::compute_offspring( int first, int last )
+{
+  INSTRUMENT_SCOPE(TRACE_REPRODUCTION);
+  assert(first >= 0);
+  assert(last <= _parameters->get_population_size());
+  double time   = (_telemetry != NULL ? _telemetry->get_time() : 0.0);
+  double sample = 0.0;
+  for (int new_index = first; new_index < last; new_index++)
+  {
+    int  i               = _parents[new_index];
+    _next_pop[new_index] = new Individual(*_pop[i]);
+    bool last            = (new_index == _parameters->get_population_size()-1 || _parents[new_index+1] != i);
+    bool sampled         = (_telemetry != NULL && new_index%TELEMETRY_SAMPLING == 0);
+    if (sampled)
+    {
+      sample = _telemetry->get_time();
+    }
+    _next_pop[new_index]->mutate(_parameters->get_m_mu(), _parameters->get_m_sigma(), _parameters->get_m_theta(), _parameters->get_s_mu(), _parameters->get_s_sigma(), _parameters->get_s_theta());
+    if (sampled)
+    {
+      _telemetry->add_sampled_phase_time(MUTATION, sample);
+    }
+    _next_pop[new_index]->set_identifier(_current_identifier++);
+    _next_pop[new_index]->set_generation(_next_generation);
+    _next_pop[new_index]->build_phenotype();
+    if (sampled)
+    {
+      _telemetry->add_sampled_phase_time(PHENOTYPE, sample);
+    }
+    if (!_parameters->get_mean_fitness())
+    {
+      _pop[i]->compute_fitness(_parameters->get_alpha(), _parameters->get_beta(), _parameters->get_Q());
+      if (!last)
       {
-        best_w = _w[new_index];
-        best   = new_index;
+        _pop[i]->compute_mu_fitness(_parameters->get_alpha(), _parameters->get_beta(), _parameters->get_Q());
       }
-      new_index++;
     }
-    delete _pop[i];
-    _pop[i] = NULL;
+    else
+    {
+      _pop[i]->compute_mean_fitness(_parameters->get_alpha(), _parameters->get_beta(), _parameters->get_Q());
+    }
+    if (sampled)
+    {
+      _telemetry->add_sampled_phase_time(FITNESS, sample);
+    }
+    if (_tree != NULL || _lod != NULL)
+    {
+      _next_pop[new_index]->compute_diagnostics();
+    }
+    if (_tree != NULL)
+    {
+      _tree->add_reproduction_event(i, _next_pop[new_index]);
+    }
+    if (_lod != NULL)
+    {
+      _lod->add_reproduction_event(i, _next_pop[new_index]);
+    }
+    _w[new_index]  = _pop[i]->get_Wz();
+    _w_sum        += _w[new_index];
+    if (last)
+    {
+      delete _pop[i];
+      _pop[i] = NULL;
+    }
   }
-  delete[] _pop;
-  _pop = new_pop;
-  delete[] draws;
-  draws = NULL;
+  if (_telemetry != NULL)
+  {
+    _telemetry->add_reproduction_time(time);
+  }
+}
+
+/**
+ * \brief    Complete the computation of the next generation
+ * \details  The offspring replace the parents, and their fitness is normalized
+ * \param    void
+ * \return   \e void
+ */
+void Population::end_generation( void )
+{
+  INSTRUMENT_SCOPE(TRACE_REPRODUCTION);
+  double       time = (_telemetry != NULL ? _telemetry->get_time() : 0.0);
+  Individual** pop  = _pop;
+  _pop              = _next_pop;
+  _next_pop         = pop;
   for (int i = 0; i < _parameters->get_population_size(); i++)
   {
     _w[i] /= _w_sum;
   }
-  //_tree->prune();
-  //_pop[best]->write_mu(next_generation);
-  //_pop[best]->write_sigma(next_generation);
-  //_pop[best]->write_theta(next_generation);
+  if (_tree != NULL)
+  {
+    _tree->prune();
+  }
+  if (_telemetry != NULL)
+  {
+    _telemetry->add_reproduction_time(time);
+  }
+}
+
+/**
+ * \brief    Compute the next generation
+ * \details  --
+ * \param    int next_generation
+ * \return   \e void
+ */
+void Population::compute_next_generation( int next_generation )
+{
+  begin_generation(next_generation);
+  compute_offspring(0, _parameters->get_population_size());
+  end_generation();
+}
+
+/**
+ * \brief    Compute the mapping properties of the whole population
+ * \details  Must be called before the optimum moves, and before saving the population
+ * \param    void
+ * \return   \e void
+ */
+void Population::compute_diagnostics( void )
+{
+  for (int i = 0; i < _parameters->get_population_size(); i++)
+  {
+    _pop[i]->compute_diagnostics();
+  }
+}
+
+/**
+ * \brief    Save the population in a backup file
+ * \details  --
+ * \param    std::ofstream& backup_file
+ * \return   \e void
+ */
+void Population::save( std::ofstream& backup_file ) const
+{
+  backup_file.write((char*)&_current_identifier, sizeof(_current_identifier));
+  backup_file.write((char*)&_w_sum, sizeof(_w_sum));
+  backup_file.write((char*)_w, sizeof(double)*_parameters->get_population_size());
+  for (int i = 0; i < _parameters->get_population_size(); i++)
+  {
+    _pop[i]->save(backup_file);
+  }
 }
 
 /*----------------------------
  * PROTECTED METHODS
  *----------------------------*/
 
+/**
+ * \brief    Allocate the buffers of the next generation
+ * \details  Buffers are reused from one generation to the next. The tile size is the number of offspring whose data, and
+ *           the data of their parents, fit in the L2 cache (TILE_CACHE_SIZE if the cache size is unknown)
+ * \param    void
+ * \return   \e void
+ */
+void Population::allocate_generation_buffers( void )
+{
+  _next_pop        = new Individual*[_parameters->get_population_size()];
+  _draws           = new unsigned int[_parameters->get_population_size()];
+  _parents         = new int[_parameters->get_population_size()];
+  _next_generation = 0;
+  for (int i = 0; i < _parameters->get_population_size(); i++)
+  {
+    _next_pop[i] = NULL;
+  }
+  long int cache_size = 0;
+#ifdef _SC_LEVEL2_CACHE_SIZE
+  cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+  if (cache_size <= 0)
+  {
+    cache_size = TILE_CACHE_SIZE;
+  }
+  long int n          = (long int)_parameters->get_number_of_dimensions();
+  long int individual = (long int)sizeof(Individual)+(long int)sizeof(double)*(4*n+n*(n-1)/2+2*n*n);
+  _tile_size          = (int)(cache_size/(2*individual));
+  _tile_size          = (_tile_size < 1 ? 1 : _tile_size);
+}
+
@@ -31,6 +31,8 @@
 #define __SigmaFGM__Population__
 
 #include <iostream>
+#include <fstream>
+#include <unistd.h>
 #include <assert.h>
 
 #include "Macros.h"
@@ -40,6 +42,9 @@
 #include "Individual.h"
 #include "Environment.h"
 #include "Tree.h"
+#include "LineOfDescent.h"
+#include "Telemetry.h"
+#include "Instrumentation.h"
 
 class Population
 {
@@ -50,7 +55,8 @@ public:
    * CONSTRUCTORS
    *----------------------------*/
   Population( void ) = delete;
-  Population( Parameters* parameters, Environment* environment, Tree* tree );
+  Population( Parameters* parameters, Environment* environment );
+  Population( Parameters* parameters, Environment* environment, std::ifstream& backup_file );
   Population( const Population& population ) = delete;
   
   /*----------------------------
@@ -63,16 +69,27 @@ public:
    *----------------------------*/
   inline int         get_population_size( void ) const;
   inline Individual* get_individual( int i );
+  inline Individual* get_offspring( int i );
+  inline int         get_tile_size( void ) const;
   
   /*----------------------------
    * SETTERS
    *----------------------------*/
   Population& operator=(const Population&) = delete;
   
+  inline void set_tree( Tree* tree );
+  inline void set_line_of_descent( LineOfDescent* line_of_descent );
+  inline void set_telemetry( Telemetry* telemetry );
+  
   /*----------------------------
    * PUBLIC METHODS
    *----------------------------*/
+  void begin_generation( int next_generation );
+  void compute_offspring( int first, int last );
+  void end_generation( void );
   void compute_next_generation( int next_generation );
+  void compute_diagnostics( void );
+  void save( std::ofstream& backup_file ) const;
   
   /*----------------------------
    * PUBLIC ATTRIBUTES
@@ -83,6 +100,7 @@ protected:
   /*----------------------------
    * PROTECTED METHODS
    *----------------------------*/
+  void allocate_generation_buffers( void );
   
   /*----------------------------
    * PROTECTED ATTRIBUTES
@@ -93,7 +111,9 @@ protected:
   Parameters*            _parameters;         /*!< Parameters                     */
   Prng*                  _prng;               /*!< Pseudorandom numbers generator */
   Environment*           _environment;        /*!< Environment (fitness optimum)  */
-  Tree*                  _tree;               /*!< Lineage tree                   */
+  Tree*                  _tree;               /*!< Lineage tree (NULL if none)    */
+  LineOfDescent*         _lod;                /*!< Line of descent (NULL if none) */
+  Telemetry*             _telemetry;          /*!< Telemetry (NULL if none)       */
   unsigned long long int _current_identifier; /*!< Current individual identifier  */
   
   /*----------------------------------------------- POPULATION */
@@ -101,6 +121,14 @@ protected:
   Individual** _pop;   /*!< Population vector               */
   double*      _w;     /*!< Fitness vector                  */
   double       _w_sum; /*!< Fitness sum (for normalization) */
+  
+  /*----------------------------------------------- NEXT GENERATION */
+  
+  Individual**  _next_pop;        /*!< Offspring vector                         */
+  unsigned int* _draws;           /*!< Number of offspring of each parent       */
+  int*          _parents;         /*!< Parent of each offspring                 */
+  int           _next_generation; /*!< Generation of the offspring              */
+  int           _tile_size;       /*!< Number of offspring fitting in the cache */
 };
 
 /*----------------------------
@@ -129,9 +157,63 @@ inline Individual* Population::get_individual( int i )
   return _pop[i];
 }
 
+/**
+ * \brief    Get offspring i of the generation being computed
+ * \details  Only valid between begin_generation() and end_generation(), once the offspring has been computed
+ * \param    int i
+ * \return   \e Individual*
+ */
+inline Individual* Population::get_offspring( int i )
+{
+  return _next_pop[i];
+}
+
+/**
+ * \brief    Get the tile size
+ * \details  Number of offspring whose data (and the data of their parents) fit in the L2 cache
+ * \param    void
+ * \return   \e int
+ */
+inline int Population::get_tile_size( void ) const
+{
+  return _tile_size;
+}
+
 /*----------------------------
  * SETTERS
  *----------------------------*/
 
+/**
+ * \brief    Set the lineage tree
+ * \details  Reproduction events are recorded in the tree from now on (NULL to stop the recording)
+ * \param    Tree* tree
+ * \return   \e void
+ */
+inline void Population::set_tree( Tree* tree )
+{
+  _tree = tree;
+}
+
+/**
+ * \brief    Set the line of descent recorder
+ * \details  Reproduction events are recorded in the line of descent from now on (NULL to stop the recording)
+ * \param    LineOfDescent* line_of_descent
+ * \return   \e void
+ */
+inline void Population::set_line_of_descent( LineOfDescent* line_of_descent )
+{
+  _lod = line_of_descent;
+}
+
+/**
+ * \brief    Set the telemetry
+ * \details  The phases of each generation are timed from now on (NULL to stop the timing)
+ * \param    Telemetry* telemetry
+ * \return   \e void
+ */
+inline void Population::set_telemetry( Telemetry* telemetry )
+{
+  _telemetry = telemetry;
+}
 
 #endif /* defined(__SigmaFGM__Population__) */
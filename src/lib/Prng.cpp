@@ -215,6 +215,73 @@ void Prng::shuffle( void* base, size_t n, size_t size )
   gsl_ran_shuffle(_prng, base, n, size);
 }
 
+/**
+ * \brief    Save the generator state
+ * \details  The raw GSL state is saved, preceded by the generator name and state size
+ * \param    std::ofstream& backup_file
+ * \return   \e void
+ */
+void Prng::save( std::ofstream& backup_file ) const
+{
+  char name[32];
+  memset(name, 0, sizeof(name));
+  strncpy(name, gsl_rng_name(_prng), sizeof(name)-1);
+  unsigned long long int size = (unsigned long long int)gsl_rng_size(_prng);
+  backup_file.write(name, sizeof(name));
+  backup_file.write((char*)&size, sizeof(size));
+  backup_file.write((char*)gsl_rng_state(_prng), gsl_rng_size(_prng));
+}
+
+/**
+ * \brief    Load the generator state
+ * \details  The saved generator must be of the same type than the current one
+ * \param    std::ifstream& backup_file
+ * \return   \e void
+ */
+void Prng::load( std::ifstream& backup_file )
+{
+  char                   name[32];
+  unsigned long long int size = 0;
+  backup_file.read(name, sizeof(name));
+  backup_file.read((char*)&size, sizeof(size));
+  name[sizeof(name)-1] = '\0';
+  if (strcmp(name, gsl_rng_name(_prng)) != 0 || size != (unsigned long long int)gsl_rng_size(_prng))
+  {
+    printf("Error in Prng::load(): the saved generator (%s) does not match the current one (%s). Exit.\n", name, gsl_rng_name(_prng));
+    exit(EXIT_FAILURE);
+  }
+  backup_file.read((char*)gsl_rng_state(_prng), gsl_rng_size(_prng));
+}
+
+/**
+ * \brief    Check that the saved generator state can be loaded
+ * \details  Returns false and describes the problem in error if the saved generator is not of the same type than the
+ *           current one. The generator state is skipped
+ * \param    std::ifstream& backup_file
+ * \param    std::string& error
+ * \return   \e bool
+ */
+bool Prng::check_backup( std::ifstream& backup_file, std::string& error ) const
+{
+  char                   name[32];
+  unsigned long long int size = 0;
+  backup_file.read(name, sizeof(name));
+  backup_file.read((char*)&size, sizeof(size));
+  name[sizeof(name)-1] = '\0';
+  if (!backup_file)
+  {
+    error = "the checkpoint file is truncated";
+    return false;
+  }
+  if (strcmp(name, gsl_rng_name(_prng)) != 0 || size != (unsigned long long int)gsl_rng_size(_prng))
+  {
+    error = std::string("the saved generator (")+name+") does not match the current one ("+gsl_rng_name(_prng)+")";
+    return false;
+  }
+  backup_file.seekg((std::streamoff)size, std::ios::cur);
+  return true;
+}
+
 /*----------------------------
  * PROTECTED METHODS
  *----------------------------*/
@@ -31,6 +31,9 @@
 #define __SigmaFGM__Prng__
 
 #include <iostream>
+#include <fstream>
+#include <string>
+#include <cstring>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 #include <cmath>
@@ -76,6 +79,9 @@ public:
   int    poisson( double mu );
   int    roulette_wheel( double* probas, double sum, int N );
   void   shuffle( void* base, size_t n, size_t size );
+  void   save( std::ofstream& backup_file ) const;
+  void   load( std::ifstream& backup_file );
+  bool   check_backup( std::ifstream& backup_file, std::string& error ) const;
   
   /*----------------------------
    * PUBLIC ATTRIBUTES
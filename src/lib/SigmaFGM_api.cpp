@@ -0,0 +1,340 @@
+
+/**
+ * \file      SigmaFGM_api.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     C API of the SigmaFGM shared library
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "SigmaFGM_api.h"
+
+#include <ctime>
+#include <assert.h>
+
+#include "Macros.h"
+#include "Enums.h"
+#include "Parameters.h"
+#include "Simulation.h"
+#include "Statistics.h"
+#include "Snapshot.h"
+
+/**
+ * \brief   Simulation handle
+ * \details Owns the parameters, the simulation and the buffers exposed through the API
+ */
+struct sfgm_simulation
+{
+  Parameters*     parameters;          /*!< Parameters                                       */
+  Simulation*     simulation;          /*!< Simulation                                       */
+  int             gathered_generation; /*!< Generation of the population buffer (-1 if none) */
+  sfgm_statistics statistics;          /*!< Statistics buffer                                */
+  sfgm_population population;          /*!< Population arrays                                */
+};
+
+static bool check_parameters( const sfgm_parameters* parameters );
+
+
+/**
+ * \brief    Get the version of the API
+ * \details  Drivers compare it with the SFGM_API_VERSION they were written for
+ * \param    void
+ * \return   \e int
+ */
+int sfgm_api_version( void )
+{
+  return SFGM_API_VERSION;
+}
+
+/**
+ * \brief    Fill a parameter structure with default values
+ * \details  Default values are the ones of example/run_SigmaFGM_simulation.py (without shutoff)
+ * \param    sfgm_parameters* parameters
+ * \return   \e void
+ */
+void sfgm_default_parameters( sfgm_parameters* parameters )
+{
+  assert(parameters != NULL);
+  parameters->seed                    = 1;
+  parameters->stabilizing_generations = 0;
+  parameters->number_of_dimensions    = 1;
+  parameters->alpha                   = 3.125;
+  parameters->beta                    = 0.1;
+  parameters->Q                       = 2.0;
+  parameters->population_size         = 1000;
+  parameters->initial_mu              = 2.0;
+  parameters->initial_sigma           = 0.6;
+  parameters->initial_theta           = 0.0;
+  parameters->oneD_shift              = 0;
+  parameters->mean_fitness            = 0;
+  parameters->m_mu                    = 1e-4;
+  parameters->m_sigma                 = 0.0;
+  parameters->m_theta                 = 0.0;
+  parameters->s_mu                    = 0.1;
+  parameters->s_sigma                 = 0.0;
+  parameters->s_theta                 = 0.0;
+  parameters->noise_type              = ISOTROPIC;
+}
+
+/**
+ * \brief    Create a simulation
+ * \details  The initial population is created and stabilized, as by SigmaFGM_simulation with the same parameters (a seed of 0
+ *           is replaced by the current time). No file is written. Returns NULL if the parameters are not valid
+ * \param    const sfgm_parameters* parameters
+ * \return   \e sfgm_simulation*
+ */
+sfgm_simulation* sfgm_create( const sfgm_parameters* parameters )
+{
+  if (!check_parameters(parameters))
+  {
+    return NULL;
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Set the parameters              */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Parameters* simulation_parameters = new Parameters();
+  simulation_parameters->set_seed(parameters->seed != 0 ? parameters->seed : (unsigned long int)time(NULL));
+  simulation_parameters->set_number_of_stabilizing_generations(parameters->stabilizing_generations);
+  simulation_parameters->set_number_of_dimensions(parameters->number_of_dimensions);
+  simulation_parameters->set_alpha(parameters->alpha);
+  simulation_parameters->set_beta(parameters->beta);
+  simulation_parameters->set_Q(parameters->Q);
+  simulation_parameters->set_population_size(parameters->population_size);
+  simulation_parameters->set_initial_mu(parameters->initial_mu);
+  simulation_parameters->set_initial_sigma(parameters->initial_sigma);
+  simulation_parameters->set_initial_theta(parameters->initial_theta);
+  simulation_parameters->set_oneD_shift(parameters->oneD_shift != 0);
+  simulation_parameters->set_mean_fitness(parameters->mean_fitness != 0);
+  simulation_parameters->set_m_mu(parameters->m_mu);
+  simulation_parameters->set_m_sigma(parameters->m_sigma);
+  simulation_parameters->set_m_theta(parameters->m_theta);
+  simulation_parameters->set_s_mu(parameters->s_mu);
+  simulation_parameters->set_s_sigma(parameters->s_sigma);
+  simulation_parameters->set_s_theta(parameters->s_theta);
+  simulation_parameters->set_noise_type((type_of_noise)parameters->noise_type);
+  simulation_parameters->set_file_output(false);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Create and stabilize            */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  sfgm_simulation* simulation     = new sfgm_simulation;
+  simulation->parameters          = simulation_parameters;
+  simulation->simulation          = new Simulation(simulation_parameters);
+  simulation->gathered_generation = -1;
+  memset(&simulation->statistics, 0, sizeof(sfgm_statistics));
+  memset(&simulation->population, 0, sizeof(sfgm_population));
+  simulation->simulation->stabilize(parameters->stabilizing_generations);
+  return simulation;
+}
+
+/**
+ * \brief    Destroy a simulation
+ * \details  Pointers returned by the getters are no longer valid
+ * \param    sfgm_simulation* simulation
+ * \return   \e void
+ */
+void sfgm_destroy( sfgm_simulation* simulation )
+{
+  if (simulation == NULL)
+  {
+    return;
+  }
+  delete simulation->simulation;
+  simulation->simulation = NULL;
+  delete simulation->parameters;
+  simulation->parameters = NULL;
+  delete simulation;
+  simulation = NULL;
+}
+
+/**
+ * \brief    Compute the next generations
+ * \details  Steps can be of any size: running 10 steps of 100 generations gives the same simulation as a single step of 1000
+ *           generations, and as SigmaFGM_simulation -g 1000
+ * \param    sfgm_simulation* simulation
+ * \param    int generations
+ * \return   \e int (last generation computed, -1 if simulation is NULL)
+ */
+int sfgm_step( sfgm_simulation* simulation, int generations )
+{
+  if (simulation == NULL)
+  {
+    return -1;
+  }
+  if (generations > 0)
+  {
+    simulation->simulation->run(simulation->simulation->get_generation()+generations);
+  }
+  return simulation->simulation->get_generation();
+}
+
+/**
+ * \brief    Get the last generation computed
+ * \details  --
+ * \param    const sfgm_simulation* simulation
+ * \return   \e int (-1 if simulation is NULL)
+ */
+int sfgm_get_generation( const sfgm_simulation* simulation )
+{
+  if (simulation == NULL)
+  {
+    return -1;
+  }
+  return simulation->simulation->get_generation();
+}
+
+/**
+ * \brief    Get the statistics of the last generation
+ * \details  The returned structure is owned by the simulation, and is updated at each call. Statistics are null before the
+ *           first step
+ * \param    sfgm_simulation* simulation
+ * \return   \e const sfgm_statistics* (NULL if simulation is NULL)
+ */
+const sfgm_statistics* sfgm_get_statistics( sfgm_simulation* simulation )
+{
+  if (simulation == NULL)
+  {
+    return NULL;
+  }
+  Statistics*      statistics = simulation->simulation->get_statistics();
+  sfgm_statistics* buffer     = &simulation->statistics;
+  
+  /*----------------------------------------------- MEAN VALUES */
+  
+  buffer->dmu_mean             = statistics->get_dmu_mean();
+  buffer->dz_mean              = statistics->get_dz_mean();
+  buffer->Wmu_mean             = statistics->get_Wmu_mean();
+  buffer->Wz_mean              = statistics->get_Wz_mean();
+  buffer->EV_mean              = statistics->get_EV_mean();
+  buffer->EV_contribution_mean = statistics->get_EV_contribution_mean();
+  buffer->EV_dot_product_mean  = statistics->get_EV_dot_product_mean();
+  buffer->r_mu_mean            = statistics->get_r_mu_mean();
+  buffer->r_sigma_mean         = statistics->get_r_sigma_mean();
+  buffer->r_theta_mean         = statistics->get_r_theta_mean();
+  
+  /*----------------------------------------------- STANDARD DEVIATION VALUES */
+  
+  buffer->dmu_sd             = statistics->get_dmu_sd();
+  buffer->dz_sd              = statistics->get_dz_sd();
+  buffer->Wmu_sd             = statistics->get_Wmu_sd();
+  buffer->Wz_sd              = statistics->get_Wz_sd();
+  buffer->EV_sd              = statistics->get_EV_sd();
+  buffer->EV_contribution_sd = statistics->get_EV_contribution_sd();
+  buffer->EV_dot_product_sd  = statistics->get_EV_dot_product_sd();
+  buffer->r_mu_sd            = statistics->get_r_mu_sd();
+  buffer->r_sigma_sd         = statistics->get_r_sigma_sd();
+  buffer->r_theta_sd         = statistics->get_r_theta_sd();
+  return buffer;
+}
+
+/**
+ * \brief    Get the population arrays of the last generation
+ * \details  The population is gathered in the snapshot buffer of the simulation, once per generation. The buffer is allocated
+ *           at the first call, so that array pointers are the same for the rest of the simulation; their content is only
+ *           updated by this call, and must be copied if needed after the next step
+ * \param    sfgm_simulation* simulation
+ * \return   \e const sfgm_population* (NULL if simulation is NULL)
+ */
+const sfgm_population* sfgm_get_population( sfgm_simulation* simulation )
+{
+  if (simulation == NULL)
+  {
+    return NULL;
+  }
+  int generation = simulation->simulation->get_generation();
+  if (simulation->gathered_generation == generation)
+  {
+    return &simulation->population;
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Gather the population           */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Snapshot* snapshot = simulation->simulation->get_snapshot();
+  snapshot->gather(simulation->simulation->get_population(), generation);
+  simulation->gathered_generation = generation;
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Point the arrays in the buffer  */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  const snapshot_header* header     = snapshot->get_header();
+  const char*            data       = snapshot->get_buffer();
+  sfgm_population*       population = &simulation->population;
+  population->generation            = generation;
+  population->population_size       = header->population_size;
+  population->number_of_dimensions  = header->number_of_dimensions;
+  population->mu_size               = header->mu_size;
+  population->sigma_size            = header->sigma_size;
+  population->theta_size            = header->theta_size;
+  population->z_size                = header->z_size;
+  population->identifier            = (const unsigned long long int*)(data+header->identifier_offset);
+  population->mu                    = (const double*)(data+header->mu_offset);
+  population->sigma                 = (header->sigma_size > 0 ? (const double*)(data+header->sigma_offset) : NULL);
+  population->theta                 = (header->theta_size > 0 ? (const double*)(data+header->theta_offset) : NULL);
+  population->z                     = (const double*)(data+header->z_offset);
+  population->dmu                   = (const double*)(data+header->dmu_offset);
+  population->dz                    = (const double*)(data+header->dz_offset);
+  population->Wmu                   = (const double*)(data+header->Wmu_offset);
+  population->Wz                    = (const double*)(data+header->Wz_offset);
+  return population;
+}
+
+/**
+ * \brief    Check the parameters of a simulation
+ * \details  Same conditions as the setters of the Parameters class
+ * \param    const sfgm_parameters* parameters
+ * \return   \e bool
+ */
+static bool check_parameters( const sfgm_parameters* parameters )
+{
+  if (parameters == NULL)
+  {
+    return false;
+  }
+  if (parameters->stabilizing_generations < 0 || parameters->number_of_dimensions <= 0 || parameters->population_size <= 0)
+  {
+    return false;
+  }
+  if (parameters->beta < 0.0 || parameters->beta > 1.0 || parameters->Q < 0.0 || (int)parameters->Q%2 != 0)
+  {
+    return false;
+  }
+  if (parameters->initial_sigma < 0.0)
+  {
+    return false;
+  }
+  if (parameters->m_mu < 0.0 || parameters->m_mu > 1.0 || parameters->m_sigma < 0.0 || parameters->m_sigma > 1.0 || parameters->m_theta < 0.0 || parameters->m_theta > 1.0)
+  {
+    return false;
+  }
+  if (parameters->s_mu < 0.0 || parameters->s_sigma < 0.0 || parameters->s_theta < 0.0)
+  {
+    return false;
+  }
+  if (parameters->noise_type < NONE || parameters->noise_type > FULL)
+  {
+    return false;
+  }
+  return true;
+}
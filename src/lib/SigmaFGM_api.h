@@ -0,0 +1,140 @@
+
+/**
+ * \file      SigmaFGM_api.h
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     C API of the SigmaFGM shared library
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#ifndef __SigmaFGM__SigmaFGM_api__
+#define __SigmaFGM__SigmaFGM_api__
+
+/* Incremented each time a structure or a function signature changes */
+#define SFGM_API_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  
+/**
+ * \brief   Simulation handle
+ * \details Opaque structure, only manipulated through pointers
+ */
+typedef struct sfgm_simulation sfgm_simulation;
+  
+/**
+ * \brief   Simulation parameters
+ * \details Same parameters as the command line of SigmaFGM_simulation (see sfgm_default_parameters())
+ */
+typedef struct
+{
+  unsigned long int seed;                    /*!< Prng seed                                                   */
+  int               stabilizing_generations; /*!< Number of generations used to stabilize initial population  */
+  int               number_of_dimensions;    /*!< Number of dimensions                                        */
+  double            alpha;                   /*!< Alpha parameter (controls the decay rate)                   */
+  double            beta;                    /*!< Beta parameter (controls the initial height)                */
+  double            Q;                       /*!< Q parameter (controls the curvature)                        */
+  int               population_size;         /*!< Number of particles                                         */
+  double            initial_mu;              /*!< Initial mu value                                            */
+  double            initial_sigma;           /*!< Initial sigma value                                         */
+  double            initial_theta;           /*!< Initial theta value                                         */
+  int               oneD_shift;              /*!< The population is shifted in one dimension                  */
+  int               mean_fitness;            /*!< The mean fitness is computed                                */
+  double            m_mu;                    /*!< mu mutation rate                                            */
+  double            m_sigma;                 /*!< sigma mutation rate                                         */
+  double            m_theta;                 /*!< theta mutation rate                                         */
+  double            s_mu;                    /*!< mu mutation size                                            */
+  double            s_sigma;                 /*!< sigma mutation size                                         */
+  double            s_theta;                 /*!< theta mutation size                                         */
+  int               noise_type;              /*!< Type of phenotypic noise (values of type_of_noise)          */
+} sfgm_parameters;
+  
+/**
+ * \brief   Population statistics
+ * \details Same values as the last line of mean.txt and sd.txt
+ */
+typedef struct
+{
+  double dmu_mean;             /*!< Genetic distance                 */
+  double dz_mean;              /*!< Phenotypic distance              */
+  double Wmu_mean;             /*!< Genetic fitness                  */
+  double Wz_mean;              /*!< Phenotypic fitness               */
+  double EV_mean;              /*!< Best eigen value                 */
+  double EV_contribution_mean; /*!< Best eigen value contribution    */
+  double EV_dot_product_mean;  /*!< Best dot product                 */
+  double r_mu_mean;            /*!< Euclidean size of mu mutation    */
+  double r_sigma_mean;         /*!< Euclidean size of sigma mutation */
+  double r_theta_mean;         /*!< Euclidean size of theta mutation */
+  double dmu_sd;               /*!< Genetic distance                 */
+  double dz_sd;                /*!< Phenotypic distance              */
+  double Wmu_sd;               /*!< Genetic fitness                  */
+  double Wz_sd;                /*!< Phenotypic fitness               */
+  double EV_sd;                /*!< Best eigen value                 */
+  double EV_contribution_sd;   /*!< Best eigen value contribution    */
+  double EV_dot_product_sd;    /*!< Best dot product                 */
+  double r_mu_sd;              /*!< Euclidean size of mu mutation    */
+  double r_sigma_sd;           /*!< Euclidean size of sigma mutation */
+  double r_theta_sd;           /*!< Euclidean size of theta mutation */
+} sfgm_statistics;
+  
+/**
+ * \brief   Population arrays
+ * \details Pointers into the internal population buffer (same layout as population snapshots). Vectors are stored
+ *          individual by individual (e.g. mu[i*mu_size+j]). Empty blocks are NULL
+ */
+typedef struct
+{
+  int                           generation;           /*!< Generation of the arrays              */
+  long long int                 population_size;      /*!< Number of individuals                 */
+  long long int                 number_of_dimensions; /*!< Number of dimensions                  */
+  long long int                 mu_size;              /*!< Size of mu vectors                    */
+  long long int                 sigma_size;           /*!< Size of sigma vectors                 */
+  long long int                 theta_size;           /*!< Size of theta vectors                 */
+  long long int                 z_size;               /*!< Size of z vectors                     */
+  const unsigned long long int* identifier;           /*!< Identifiers                           */
+  const double*                 mu;                   /*!< Mean phenotypes                       */
+  const double*                 sigma;                /*!< Phenotypic noise amplitudes           */
+  const double*                 theta;                /*!< Phenotypic noise orientations         */
+  const double*                 z;                    /*!< Phenotypes                            */
+  const double*                 dmu;                  /*!< Distances of mu from the optimum      */
+  const double*                 dz;                   /*!< Distances of z from the optimum       */
+  const double*                 Wmu;                  /*!< Fitnesses of mu                       */
+  const double*                 Wz;                   /*!< Fitnesses of z                        */
+} sfgm_population;
+  
+int                    sfgm_api_version( void );
+void                   sfgm_default_parameters( sfgm_parameters* parameters );
+sfgm_simulation*       sfgm_create( const sfgm_parameters* parameters );
+void                   sfgm_destroy( sfgm_simulation* simulation );
+int                    sfgm_step( sfgm_simulation* simulation, int generations );
+int                    sfgm_get_generation( const sfgm_simulation* simulation );
+const sfgm_statistics* sfgm_get_statistics( sfgm_simulation* simulation );
+const sfgm_population* sfgm_get_population( sfgm_simulation* simulation );
+  
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* defined(__SigmaFGM__SigmaFGM_api__) */
@@ -29,6 +29,7 @@
 
 #include "Simulation.h"
 
+volatile sig_atomic_t Simulation::_stop_requested = 0;
 
 /*----------------------------
  * CONSTRUCTORS
@@ -52,9 +53,120 @@ Simulation::Simulation( Parameters* parameters )
   /*----------------------------------------------- SIMULATION */
   
   _environment = new Environment(_parameters);
-  _tree        = new Tree();
-  _population  = new Population(_parameters, _environment, _tree);
-  _statistics  = new Statistics();
+  _tree        = NULL;
+  _lod         = NULL;
+  _population  = new Population(_parameters, _environment);
+  _statistics  = new Statistics(_parameters);
+  _snapshot    = new Snapshot(_parameters);
+  _telemetry   = NULL;
+  if (_parameters->get_telemetry_interval() > 0)
+  {
+    _telemetry = new Telemetry(_parameters, false);
+    _population->set_telemetry(_telemetry);
+  }
+  _instrumentation = NULL;
+#ifdef WITH_INSTRUMENTATION
+  if (_parameters->get_file_output())
+  {
+    _instrumentation = new Instrumentation(_parameters, false);
+  }
+#endif
+  
+  /*----------------------------------------------- SIMULATION STATE */
+  
+  _phase       = (_parameters->get_number_of_stabilizing_generations() > 0 ? STABILIZATION : EVOLUTION);
+  _generation  = 0;
+  _interrupted = false;
+}
+
+/**
+ * \brief    Constructor from backup file
+ * \details  Restores the simulation saved in a checkpoint. Parameters defining the model must be identical (see check_backup())
+ * \param    Parameters* parameters
+ * \param    std::string backup_filename
+ * \return   \e void
+ */
+Simulation::Simulation( Parameters* parameters, std::string backup_filename )
+{
+  assert(parameters != NULL);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Check the checkpoint               */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::string error;
+  if (!check_backup(parameters, backup_filename, error))
+  {
+    printf("Error in Simulation::Simulation(): %s. Exit.\n", error.c_str());
+    exit(EXIT_FAILURE);
+  }
+  std::ifstream backup_file(backup_filename.c_str(), std::ios::in | std::ios::binary);
+  char                   magic[8];
+  unsigned int           version         = 0;
+  unsigned long long int size            = 0;
+  int                    number_of_files = 0;
+  backup_file.read(magic, sizeof(magic));
+  backup_file.read((char*)&version, sizeof(version));
+  backup_file.read((char*)&size, sizeof(size));
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Load the simulation state          */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  int  phase     = 0;
+  bool lineage   = false;
+  int  lod_depth = 0;
+  backup_file.read((char*)&phase, sizeof(phase));
+  backup_file.read((char*)&_generation, sizeof(_generation));
+  backup_file.read((char*)&lineage, sizeof(lineage));
+  backup_file.read((char*)&lod_depth, sizeof(lod_depth));
+  backup_file.read((char*)&number_of_files, sizeof(number_of_files));
+  for (int i = 0; i < number_of_files; i++)
+  {
+    int length = 0;
+    backup_file.read((char*)&length, sizeof(length));
+    backup_file.seekg(length, std::ios::cur);
+  }
+  _phase       = (simulation_phase)phase;
+  _interrupted = false;
+  
+  /*----------------------------------------------- PARAMETERS */
+  
+  _parameters = parameters;
+  _parameters->check_backup(backup_file, error);
+  _prng = _parameters->get_prng();
+  _prng->load(backup_file);
+  
+  /*----------------------------------------------- SIMULATION */
+  
+  _environment = new Environment(_parameters, backup_file);
+  _tree        = NULL;
+  _lod         = NULL;
+  _population  = new Population(_parameters, _environment, backup_file);
+  if (lineage)
+  {
+    _tree = new Tree(_parameters, backup_file);
+    _population->set_tree(_tree);
+  }
+  if (lod_depth > 0)
+  {
+    _lod = new LineOfDescent(_parameters, backup_file);
+    _population->set_line_of_descent(_lod);
+  }
+  _statistics  = new Statistics(_parameters, backup_file);
+  _snapshot    = new Snapshot(_parameters);
+  _telemetry   = NULL;
+  if (_parameters->get_telemetry_interval() > 0)
+  {
+    _telemetry = new Telemetry(_parameters, true);
+    _population->set_telemetry(_telemetry);
+  }
+  _instrumentation = NULL;
+#ifdef WITH_INSTRUMENTATION
+  if (_parameters->get_file_output())
+  {
+    _instrumentation = new Instrumentation(_parameters, true);
+  }
+#endif
+  backup_file.close();
 }
 
 /*----------------------------
@@ -82,14 +194,208 @@ Simulation::~Simulation( void )
   _population = NULL;
   delete _tree;
   _tree = NULL;
+  delete _lod;
+  _lod = NULL;
   delete _statistics;
   _statistics = NULL;
+  delete _snapshot;
+  _snapshot = NULL;
+  delete _telemetry;
+  _telemetry = NULL;
+  delete _instrumentation;
+  _instrumentation = NULL;
 }
 
 /*----------------------------
  * PUBLIC METHODS
  *----------------------------*/
 
+/**
+ * \brief    Create a simulation from its parameters
+ * \details  Exits if the checkpoint to start from is not valid (see create(Parameters*, std::string&))
+ * \param    Parameters* parameters
+ * \return   \e Simulation*
+ */
+Simulation* Simulation::create( Parameters* parameters )
+{
+  std::string error;
+  Simulation* simulation = create(parameters, error);
+  if (simulation == NULL)
+  {
+    printf("Error in Simulation::create(): %s. Exit.\n", error.c_str());
+    exit(EXIT_FAILURE);
+  }
+  return simulation;
+}
+
+/**
+ * \brief    Create a simulation from its parameters, without exiting on an invalid checkpoint
+ * \details  Creates the output and stabilization cache folders (with their parents). The simulation is resumed from the checkpoint given
+ *           with -resume if any, else starts from the stabilized population of the cache if it exists, else is new.
+ *           The checkpoint is validated first: if it cannot be loaded, NULL is returned and the problem is described in error
+ * \param    Parameters* parameters
+ * \param    std::string& error
+ * \return   \e Simulation*
+ */
+Simulation* Simulation::create( Parameters* parameters, std::string& error )
+{
+  assert(parameters != NULL);
+  std::string backup_filename = parameters->get_resume_filename();
+  std::string cache_filename  = parameters->get_stabilization_cache_filename();
+  struct stat cache_stat;
+  make_directory(parameters->get_output_path());
+  if (cache_filename != "")
+  {
+    make_directory(parameters->get_stabilization_cache());
+  }
+  if (backup_filename == "" && cache_filename != "" && stat(cache_filename.c_str(), &cache_stat) == 0)
+  {
+    /* Load the stabilized population from the cache */
+    backup_filename = cache_filename;
+  }
+  if (backup_filename == "")
+  {
+    return new Simulation(parameters);
+  }
+  if (!check_backup(parameters, backup_filename, error))
+  {
+    return NULL;
+  }
+  return new Simulation(parameters, backup_filename);
+}
+
+/**
+ * \brief    Check that a simulation can be resumed from a checkpoint
+ * \details  Nothing is modified: the checkpoint header, parameters and generator are read, and the output files the resumed
+ *           simulation reopens must exist. Returns false and describes the problem in error if the checkpoint cannot be loaded
+ * \param    Parameters* parameters
+ * \param    std::string backup_filename
+ * \param    std::string& error
+ * \return   \e bool
+ */
+bool Simulation::check_backup( Parameters* parameters, std::string backup_filename, std::string& error )
+{
+  assert(parameters != NULL);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Open the checkpoint                */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::ifstream backup_file(backup_filename.c_str(), std::ios::in | std::ios::binary);
+  if (!backup_file)
+  {
+    error = "impossible to open checkpoint file "+backup_filename;
+    return false;
+  }
+  char                   magic[8];
+  unsigned int           version = 0;
+  unsigned long long int size    = 0;
+  backup_file.read(magic, sizeof(magic));
+  backup_file.read((char*)&version, sizeof(version));
+  backup_file.read((char*)&size, sizeof(size));
+  if (!backup_file || strncmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0 || version != CHECKPOINT_VERSION)
+  {
+    error = backup_filename+" is not a valid checkpoint file";
+    return false;
+  }
+  std::streampos position = backup_file.tellg();
+  backup_file.seekg(0, std::ios::end);
+  if ((unsigned long long int)backup_file.tellg() != size)
+  {
+    error = "checkpoint file "+backup_filename+" is truncated";
+    return false;
+  }
+  backup_file.seekg(position);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Check the simulation state         */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  int  phase           = 0;
+  int  generation      = 0;
+  bool lineage         = false;
+  int  lod_depth       = 0;
+  int  number_of_files = 0;
+  backup_file.read((char*)&phase, sizeof(phase));
+  backup_file.read((char*)&generation, sizeof(generation));
+  backup_file.read((char*)&lineage, sizeof(lineage));
+  backup_file.read((char*)&lod_depth, sizeof(lod_depth));
+  if ((simulation_phase)phase == EVOLUTION && generation > 0 && lineage != parameters->get_lineage_tracking())
+  {
+    error = "lineage tracking cannot be changed when resuming a simulation";
+    return false;
+  }
+  if ((simulation_phase)phase == EVOLUTION && generation > 0 && lod_depth != parameters->get_line_of_descent_depth())
+  {
+    error = "line of descent depth cannot be changed when resuming a simulation";
+    return false;
+  }
+  
+  /*----------------------------------------------- RESUMED OUTPUT FILES */
+  
+  backup_file.read((char*)&number_of_files, sizeof(number_of_files));
+  for (int i = 0; i < number_of_files; i++)
+  {
+    int length = 0;
+    backup_file.read((char*)&length, sizeof(length));
+    if (!backup_file || length <= 0 || length > CHECKPOINT_NAME)
+    {
+      error = backup_filename+" is not a valid checkpoint file";
+      return false;
+    }
+    std::vector<char> name(length);
+    backup_file.read(&name[0], length);
+    std::string filename = parameters->get_output_filename(std::string(name.begin(), name.end()));
+    struct stat file_stat;
+    if (!backup_file || stat(filename.c_str(), &file_stat) != 0)
+    {
+      error = "output file "+filename+" of the checkpointed simulation is missing";
+      return false;
+    }
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Check parameters and PRNG state    */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  return parameters->check_backup(backup_file, error) && parameters->get_prng()->check_backup(backup_file, error);
+}
+
+/**
+ * \brief    Execute the simulation
+ * \details  Stabilizes the population (saving it in the stabilization cache if any), then runs the simulation, with or without shutoff.
+ *           Phases already completed (resumed or cached simulation) are skipped
+ * \param    void
+ * \return   \e void
+ */
+void Simulation::execute( void )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Stabilize the population        */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (_phase == STABILIZATION)
+  {
+    stabilize(_parameters->get_number_of_stabilizing_generations());
+    if (!_interrupted && _parameters->get_stabilization_cache_filename() != "")
+    {
+      save(_parameters->get_stabilization_cache_filename());
+    }
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Run the simulation              */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (_parameters->get_shutoff_distance() == 0)
+  {
+    run(_parameters->get_number_of_generations());
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Run the simulation with shutoff */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (_parameters->get_shutoff_distance() > 0.0)
+  {
+    run_with_shutoff(_parameters->get_shutoff_distance(), _parameters->get_shutoff_generation());
+  }
+}
+
 /**
  * \brief    Stabilize the population
  * \details  --
@@ -98,11 +404,27 @@ Simulation::~Simulation( void )
  */
 void Simulation::stabilize( int generations )
 {
+  if (_phase != STABILIZATION)
+  {
+    return;
+  }
+  if (_instrumentation != NULL)
+  {
+    _instrumentation->bind();
+  }
+  _population->compute_diagnostics();
   _environment->stabilizing_environment();
-  for (int g = 1; g <= generations; g++)
+  for (int g = _generation+1; g <= generations; g++)
   {
-    _population->compute_next_generation(g);
+    compute_generation(g, false);
+    _generation = g;
+    if (end_generation())
+    {
+      return;
+    }
   }
+  _phase      = EVOLUTION;
+  _generation = 0;
 }
 
 /**
@@ -113,41 +435,105 @@ void Simulation::stabilize( int generations )
  */
 void Simulation::run( int generations )
 {
-  _environment->normal_environment();
-  _statistics->write_headers();
-  for (int g = 1; g <= generations; g++)
+  if (_phase != EVOLUTION)
   {
-    _population->compute_next_generation(g);
-    _statistics->reset();
-    _statistics->compute_statistics(_population);
+    return;
+  }
+  if (_instrumentation != NULL)
+  {
+    _instrumentation->bind();
+  }
+  if (_generation == 0)
+  {
+    _population->compute_diagnostics();
+    _environment->normal_environment();
+    _statistics->write_headers();
+    initialize_tree();
+    initialize_line_of_descent();
+    if (_snapshot->is_snapshot_generation(0))
+    {
+      _snapshot->write_snapshot(_population, 0);
+    }
+  }
+  for (int g = _generation+1; g <= generations; g++)
+  {
+    compute_generation(g, true);
+    double time = (_telemetry != NULL ? _telemetry->get_time() : 0.0);
     _statistics->write_statistics(g);
     _statistics->flush();
+    if (_snapshot->is_snapshot_generation(g))
+    {
+      _snapshot->write_snapshot(_population, g);
+    }
+    if (_telemetry != NULL)
+    {
+      _telemetry->add_phase_time(OUTPUT, time);
+    }
+    _generation = g;
+    if (end_generation())
+    {
+      break;
+    }
   }
   _statistics->close();
-  //_tree->write_best_lineage_statistics();
+  if (_tree != NULL && !_interrupted)
+  {
+    _tree->write_best_lineage_statistics(_parameters->get_output_filename("best_lineage.txt"));
+    _tree->write_tree_sequence();
+  }
+  if (_lod != NULL && !_interrupted)
+  {
+    _lod->write_line_of_descent(_parameters->get_output_filename("line_of_descent.txt"));
+  }
 }
 
 /**
  * \brief    Run the simulation with shutoff
- * \details  --
+ * \details  Every generation, including the last one, ends with end_generation(), so that telemetry, trace and checkpoints
+ *           cover the whole run
  * \param    double shutoff_distance
  * \param    int shutoff_generation
  * \return   \e void
  */
 void Simulation::run_with_shutoff( double shutoff_distance, int shutoff_generation )
 {
-  _environment->normal_environment();
-  _statistics->write_headers();
-  int  g       = 0;
+  if (_phase != EVOLUTION)
+  {
+    return;
+  }
+  if (_instrumentation != NULL)
+  {
+    _instrumentation->bind();
+  }
+  if (_generation == 0)
+  {
+    _population->compute_diagnostics();
+    _environment->normal_environment();
+    _statistics->write_headers();
+    initialize_tree();
+    initialize_line_of_descent();
+    if (_snapshot->is_snapshot_generation(0))
+    {
+      _snapshot->write_snapshot(_population, 0);
+    }
+  }
+  int  g       = _generation;
   bool shutoff = false;
   while (!shutoff)
   {
     g++;
-    _population->compute_next_generation(g);
-    _statistics->reset();
-    _statistics->compute_statistics(_population);
+    compute_generation(g, true);
+    double time = (_telemetry != NULL ? _telemetry->get_time() : 0.0);
     _statistics->write_statistics(g);
     _statistics->flush();
+    if (_snapshot->is_snapshot_generation(g))
+    {
+      _snapshot->write_snapshot(_population, g);
+    }
+    if (_telemetry != NULL)
+    {
+      _telemetry->add_phase_time(OUTPUT, time);
+    }
     if (fabs(_statistics->get_dmu_mean()) <= fabs(shutoff_distance))
     {
       shutoff = true;
@@ -156,12 +542,251 @@ void Simulation::run_with_shutoff( double shutoff_distance, int shutoff_generati
     {
       shutoff = true;
     }
+    _generation = g;
+    if (end_generation())
+    {
+      break;
+    }
   }
   _statistics->close();
-  //_tree->write_best_lineage_statistics();
+  if (_tree != NULL && !_interrupted)
+  {
+    _tree->write_best_lineage_statistics(_parameters->get_output_filename("best_lineage.txt"));
+    _tree->write_tree_sequence();
+  }
+  if (_lod != NULL && !_interrupted)
+  {
+    _lod->write_line_of_descent(_parameters->get_output_filename("line_of_descent.txt"));
+  }
+}
+
+/**
+ * \brief    Save the simulation in a checkpoint file
+ * \details  The checkpoint is first written in a unique temporary file, then renamed, so that an existing checkpoint is never left
+ *           half-written, even if several simulations save the same file concurrently
+ * \param    std::string backup_filename
+ * \return   \e void
+ */
+void Simulation::save( std::string backup_filename )
+{
+  INSTRUMENT_SCOPE(TRACE_WRITE_CHECKPOINT);
+  std::string tmp_filename = backup_filename+".XXXXXX";
+  std::vector<char> tmp_template(tmp_filename.begin(), tmp_filename.end());
+  tmp_template.push_back('\0');
+  int fd = mkstemp(&tmp_template[0]);
+  if (fd == -1)
+  {
+    printf("Error in Simulation::save(): impossible to create checkpoint file %s. Exit.\n", tmp_filename.c_str());
+    exit(EXIT_FAILURE);
+  }
+  close(fd);
+  tmp_filename = &tmp_template[0];
+  std::ofstream backup_file(tmp_filename.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Save the simulation state          */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  unsigned int             version   = CHECKPOINT_VERSION;
+  unsigned long long int   size      = 0;
+  int                      phase     = (int)_phase;
+  bool                     lineage   = (_tree != NULL);
+  int                      lod_depth = (_lod != NULL ? _lod->get_depth() : 0);
+  std::vector<std::string> resumed_files;
+  if (lineage)
+  {
+    _tree->get_resumed_files(resumed_files);
+  }
+  _statistics->get_resumed_files(resumed_files);
+  int number_of_files = (int)resumed_files.size();
+  backup_file.write(CHECKPOINT_MAGIC, 8);
+  backup_file.write((char*)&version, sizeof(version));
+  backup_file.write((char*)&size, sizeof(size));
+  backup_file.write((char*)&phase, sizeof(phase));
+  backup_file.write((char*)&_generation, sizeof(_generation));
+  backup_file.write((char*)&lineage, sizeof(lineage));
+  backup_file.write((char*)&lod_depth, sizeof(lod_depth));
+  backup_file.write((char*)&number_of_files, sizeof(number_of_files));
+  for (int i = 0; i < number_of_files; i++)
+  {
+    int length = (int)resumed_files[i].size();
+    backup_file.write((char*)&length, sizeof(length));
+    backup_file.write(resumed_files[i].c_str(), length);
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Save parameters and PRNG state     */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  _parameters->save(backup_file);
+  _prng->save(backup_file);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Save the simulation                */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  _environment->save(backup_file);
+  _population->compute_diagnostics();
+  _population->save(backup_file);
+  if (lineage)
+  {
+    _tree->save(backup_file);
+  }
+  if (lod_depth > 0)
+  {
+    _lod->save(backup_file);
+  }
+  _statistics->save(backup_file);
+  size = (unsigned long long int)backup_file.tellp();
+  backup_file.seekp(8+sizeof(version));
+  backup_file.write((char*)&size, sizeof(size));
+  backup_file.close();
+  if (!backup_file || rename(tmp_filename.c_str(), backup_filename.c_str()) != 0)
+  {
+    printf("Error in Simulation::save(): impossible to write checkpoint file %s. Exit.\n", backup_filename.c_str());
+    exit(EXIT_FAILURE);
+  }
 }
 
 /*----------------------------
  * PROTECTED METHODS
  *----------------------------*/
 
+/**
+ * \brief    Create a folder and its missing parents
+ * \details  Existing folders are left untouched
+ * \param    std::string path
+ * \return   \e void
+ */
+void Simulation::make_directory( std::string path )
+{
+  for (size_t i = path.find('/', 1); i != std::string::npos; i = path.find('/', i+1))
+  {
+    mkdir(path.substr(0, i).c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+  }
+  mkdir(path.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+}
+
+/**
+ * \brief    Start the lineage tracking if needed
+ * \details  The lineage is tracked from the beginning of the evolution phase, the current population being the roots of the tree
+ * \param    void
+ * \return   \e void
+ */
+void Simulation::initialize_tree( void )
+{
+  if (!_parameters->get_lineage_tracking())
+  {
+    return;
+  }
+  delete _tree;
+  _tree = new Tree(_parameters);
+  for (int i = 0; i < _population->get_population_size(); i++)
+  {
+    _tree->add_root(_population->get_individual(i));
+  }
+  _population->set_tree(_tree);
+}
+
+/**
+ * \brief    Start the line of descent recording if needed
+ * \details  The line of descent is recorded from the beginning of the evolution phase, the current population being the
+ *           roots of the line
+ * \param    void
+ * \return   \e void
+ */
+void Simulation::initialize_line_of_descent( void )
+{
+  if (_parameters->get_line_of_descent_depth() == 0)
+  {
+    return;
+  }
+  delete _lod;
+  _lod = new LineOfDescent(_parameters);
+  for (int i = 0; i < _population->get_population_size(); i++)
+  {
+    _lod->add_root(_population->get_individual(i));
+  }
+  _population->set_line_of_descent(_lod);
+}
+
+/**
+ * \brief    Compute the next generation, and its statistics if needed
+ * \details  With the tiled engine, offspring are computed by tiles fitting in the L2 cache, and each tile is added to the
+ *           statistics while its offspring are still in the cache. Both engines draw the same pseudorandom numbers and
+ *           add the individuals in the same order, and thus give identical results
+ * \param    int generation
+ * \param    bool statistics
+ * \return   \e void
+ */
+void Simulation::compute_generation( int generation, bool statistics )
+{
+  if (_parameters->get_engine() == TILED && statistics)
+  {
+    int tile_size = _population->get_tile_size();
+    int N         = _population->get_population_size();
+    _statistics->reset();
+    _population->begin_generation(generation);
+    for (int first = 0; first < N; first += tile_size)
+    {
+      int last = (first+tile_size < N ? first+tile_size : N);
+      _population->compute_offspring(first, last);
+      INSTRUMENT_SCOPE(TRACE_STATISTICS);
+      double time = (_telemetry != NULL ? _telemetry->get_time() : 0.0);
+      for (int i = first; i < last; i++)
+      {
+        _statistics->add_individual(_population->get_offspring(i));
+      }
+      if (_telemetry != NULL)
+      {
+        _telemetry->add_phase_time(STATISTICS, time);
+      }
+    }
+    _population->end_generation();
+    _statistics->complete_statistics(N);
+  }
+  else
+  {
+    _population->compute_next_generation(generation);
+    if (statistics)
+    {
+      double time = (_telemetry != NULL ? _telemetry->get_time() : 0.0);
+      _statistics->reset();
+      _statistics->compute_statistics(_population);
+      if (_telemetry != NULL)
+      {
+        _telemetry->add_phase_time(STATISTICS, time);
+      }
+    }
+  }
+}
+
+/**
+ * \brief    Save a checkpoint at the end of a generation if needed
+ * \details  A checkpoint is saved every checkpoint interval, or when a stop has been requested. The generation is then
+ *           reported to the telemetry and to the instrumentation
+ * \param    void
+ * \return   \e bool (true if the simulation must stop)
+ */
+bool Simulation::end_generation( void )
+{
+  double time = (_telemetry != NULL ? _telemetry->get_time() : 0.0);
+  bool   stop = false;
+  if (_stop_requested)
+  {
+    save(_parameters->get_output_filename(CHECKPOINT_FILE));
+    _interrupted = true;
+    stop         = true;
+  }
+  else if (_parameters->get_checkpoint_interval() > 0 && _generation%_parameters->get_checkpoint_interval() == 0)
+  {
+    save(_parameters->get_output_filename(CHECKPOINT_FILE));
+  }
+  if (_telemetry != NULL)
+  {
+    _telemetry->add_phase_time(OUTPUT, time);
+    _telemetry->end_generation(_phase, _generation);
+  }
+  if (_instrumentation != NULL)
+  {
+    _instrumentation->end_generation(_phase, _generation);
+  }
+  return stop;
+}
@@ -31,6 +31,13 @@
 #define __SigmaFGM__Simulation__
 
 #include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <csignal>
+#include <unistd.h>
+#include <sys/stat.h>
 #include <assert.h>
 
 #include "Macros.h"
@@ -39,8 +46,12 @@
 #include "Parameters.h"
 #include "Environment.h"
 #include "Tree.h"
+#include "LineOfDescent.h"
 #include "Population.h"
 #include "Statistics.h"
+#include "Snapshot.h"
+#include "Telemetry.h"
+#include "Instrumentation.h"
 
 
 class Simulation
@@ -53,6 +64,7 @@ public:
    *----------------------------*/
   Simulation( void ) = delete;
   Simulation( Parameters* parameters );
+  Simulation( Parameters* parameters, std::string backup_filename );
   Simulation( const Simulation& simulation ) = delete;
   
   /*----------------------------
@@ -63,18 +75,31 @@ public:
   /*----------------------------
    * GETTERS
    *----------------------------*/
+  inline int         get_generation( void ) const;
+  inline bool        is_interrupted( void ) const;
+  inline Population* get_population( void );
+  inline Statistics* get_statistics( void );
+  inline Snapshot*   get_snapshot( void );
   
   /*----------------------------
    * SETTERS
    *----------------------------*/
   Simulation& operator=(const Simulation&) = delete;
   
+  inline static void request_stop( void );
+  
   /*----------------------------
    * PUBLIC METHODS
    *----------------------------*/
+  static Simulation* create( Parameters* parameters );
+  static Simulation* create( Parameters* parameters, std::string& error );
+  static bool        check_backup( Parameters* parameters, std::string backup_filename, std::string& error );
+  
+  void execute( void );
   void stabilize( int generations );
   void run( int generations );
   void run_with_shutoff( double shutoff_distance, int shutoff_generation );
+  void save( std::string backup_filename );
   
   /*----------------------------
    * PUBLIC ATTRIBUTES
@@ -85,6 +110,12 @@ protected:
   /*----------------------------
    * PROTECTED METHODS
    *----------------------------*/
+  static void make_directory( std::string path );
+  
+  void initialize_tree( void );
+  void initialize_line_of_descent( void );
+  void compute_generation( int generation, bool statistics );
+  bool end_generation( void );
   
   /*----------------------------
    * PROTECTED ATTRIBUTES
@@ -97,10 +128,22 @@ protected:
   
   /*----------------------------------------------- SIMULATION */
   
-  Environment* _environment; /*!< Environment  */
-  Tree*        _tree;        /*!< Lineage tree */
-  Population*  _population;  /*!< Population   */
-  Statistics*  _statistics;  /*!< Statistics   */
+  Environment*     _environment;     /*!< Environment                                                    */
+  Tree*            _tree;            /*!< Lineage tree (NULL if the lineage is not tracked)              */
+  LineOfDescent*   _lod;             /*!< Line of descent (NULL if it is not recorded)                   */
+  Population*      _population;      /*!< Population                                                     */
+  Statistics*      _statistics;      /*!< Statistics                                                     */
+  Snapshot*        _snapshot;        /*!< Snapshots                                                      */
+  Telemetry*       _telemetry;       /*!< Telemetry (NULL if off)                                        */
+  Instrumentation* _instrumentation; /*!< Instrumentation (NULL if not compiled, or without file output) */
+  
+  /*----------------------------------------------- SIMULATION STATE */
+  
+  simulation_phase _phase;       /*!< Current simulation phase                      */
+  int              _generation;  /*!< Last generation computed in the current phase */
+  bool             _interrupted; /*!< Indicates if the simulation stopped on request */
+  
+  static volatile sig_atomic_t _stop_requested; /*!< Stop request (set by a signal handler) */
   
 };
 
@@ -108,9 +151,75 @@ protected:
  * GETTERS
  *----------------------------*/
 
+/**
+ * \brief    Get the last generation computed in the current phase
+ * \details  --
+ * \param    void
+ * \return   \e int
+ */
+inline int Simulation::get_generation( void ) const
+{
+  return _generation;
+}
+
+/**
+ * \brief    Check if the simulation has been interrupted
+ * \details  When interrupted, a checkpoint has been saved at the end of the last generation
+ * \param    void
+ * \return   \e bool
+ */
+inline bool Simulation::is_interrupted( void ) const
+{
+  return _interrupted;
+}
+
+/**
+ * \brief    Get the population
+ * \details  --
+ * \param    void
+ * \return   \e Population*
+ */
+inline Population* Simulation::get_population( void )
+{
+  return _population;
+}
+
+/**
+ * \brief    Get the statistics of the last generation
+ * \details  --
+ * \param    void
+ * \return   \e Statistics*
+ */
+inline Statistics* Simulation::get_statistics( void )
+{
+  return _statistics;
+}
+
+/**
+ * \brief    Get the snapshot buffer
+ * \details  --
+ * \param    void
+ * \return   \e Snapshot*
+ */
+inline Snapshot* Simulation::get_snapshot( void )
+{
+  return _snapshot;
+}
+
 /*----------------------------
  * SETTERS
  *----------------------------*/
 
+/**
+ * \brief    Request the simulation to stop at the end of the current generation
+ * \details  Async-signal-safe, can be called from a signal handler
+ * \param    void
+ * \return   \e void
+ */
+inline void Simulation::request_stop( void )
+{
+  _stop_requested = 1;
+}
+
 
 #endif /* defined(__SigmaFGM__Simulation__) */
@@ -0,0 +1,236 @@
+
+/**
+ * \file      Snapshot.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Snapshot class definition
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "Snapshot.h"
+
+
+/*----------------------------
+ * CONSTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Constructor
+ * \details  Computes the layout of the snapshot file once. The buffer used to
+ *           write every snapshot in a single call is allocated by the first gather
+ * \param    Parameters* parameters
+ * \return   \e void
+ */
+Snapshot::Snapshot( Parameters* parameters )
+{
+  assert(parameters != NULL);
+  
+  /*----------------------------------------------- PARAMETERS */
+  
+  _parameters = parameters;
+  
+  /*----------------------------------------------- SNAPSHOT LAYOUT */
+  
+  long long int N = (long long int)_parameters->get_population_size();
+  long long int n = (long long int)_parameters->get_number_of_dimensions();
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Fill the header            */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  memset(&_header, 0, sizeof(snapshot_header));
+  memcpy(_header.magic, SNAPSHOT_MAGIC, 8);
+  _header.version              = SNAPSHOT_VERSION;
+  _header.header_size          = (unsigned int)sizeof(snapshot_header);
+  _header.generation           = 0;
+  _header.population_size      = N;
+  _header.number_of_dimensions = n;
+  _header.noise_type           = (long long int)_parameters->get_noise_type();
+  _header.mu_size              = n;
+  _header.sigma_size           = (_parameters->get_noise_type() != NONE ? n : 0);
+  _header.theta_size           = (n > 1 && _parameters->get_noise_type() == FULL ? n*(n-1)/2 : 0);
+  _header.z_size               = n;
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Compute the block offsets  */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  unsigned long long int offset = align(sizeof(snapshot_header));
+  _header.identifier_offset     = offset;
+  offset                        = align(offset+N*sizeof(unsigned long long int));
+  _header.mu_offset             = offset;
+  offset                        = align(offset+N*_header.mu_size*sizeof(double));
+  _header.sigma_offset          = offset;
+  offset                        = align(offset+N*_header.sigma_size*sizeof(double));
+  _header.theta_offset          = offset;
+  offset                        = align(offset+N*_header.theta_size*sizeof(double));
+  _header.z_offset              = offset;
+  offset                        = align(offset+N*_header.z_size*sizeof(double));
+  _header.dmu_offset            = offset;
+  offset                        = align(offset+N*sizeof(double));
+  _header.dz_offset             = offset;
+  offset                        = align(offset+N*sizeof(double));
+  _header.Wmu_offset            = offset;
+  offset                        = align(offset+N*sizeof(double));
+  _header.Wz_offset             = offset;
+  offset                        = align(offset+N*sizeof(double));
+  _header.file_size             = offset;
+  
+  _buffer                       = NULL;
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Create the output folder   */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (_parameters->get_snapshot_interval() > 0)
+  {
+    mkdir(_parameters->get_output_filename("output").c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+  }
+}
+
+/*----------------------------
+ * DESTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Destructor
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+Snapshot::~Snapshot( void )
+{
+  _parameters = NULL;
+  delete[] _buffer;
+  _buffer = NULL;
+}
+
+/*----------------------------
+ * PUBLIC METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Gather the population in the snapshot buffer
+ * \details  The buffer holds the header and the population blocks, laid out as in the snapshot file.
+ *           It is allocated at the first call, and reused afterwards
+ * \param    Population* population
+ * \param    int generation
+ * \return   \e void
+ */
+void Snapshot::gather( Population* population, int generation )
+{
+  assert(population != NULL);
+  assert(population->get_population_size() == _header.population_size);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Write the header           */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (_buffer == NULL)
+  {
+    _buffer = new char[_header.file_size];
+    memset(_buffer, 0, _header.file_size);
+  }
+  _header.generation = generation;
+  memcpy(_buffer, &_header, sizeof(snapshot_header));
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Gather the population      */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  unsigned long long int* identifier = (unsigned long long int*)(_buffer+_header.identifier_offset);
+  double*                 mu         = (double*)(_buffer+_header.mu_offset);
+  double*                 sigma      = (double*)(_buffer+_header.sigma_offset);
+  double*                 theta      = (double*)(_buffer+_header.theta_offset);
+  double*                 z          = (double*)(_buffer+_header.z_offset);
+  double*                 dmu        = (double*)(_buffer+_header.dmu_offset);
+  double*                 dz         = (double*)(_buffer+_header.dz_offset);
+  double*                 Wmu        = (double*)(_buffer+_header.Wmu_offset);
+  double*                 Wz         = (double*)(_buffer+_header.Wz_offset);
+  for (int i = 0; i < (int)_header.population_size; i++)
+  {
+    Individual* ind = population->get_individual(i);
+    identifier[i]   = ind->get_identifier();
+    for (int j = 0; j < (int)_header.mu_size; j++)
+    {
+      mu[i*_header.mu_size+j] = ind->get_mu(j);
+    }
+    for (int j = 0; j < (int)_header.sigma_size; j++)
+    {
+      sigma[i*_header.sigma_size+j] = ind->get_sigma(j);
+    }
+    for (int j = 0; j < (int)_header.theta_size; j++)
+    {
+      theta[i*_header.theta_size+j] = ind->get_theta(j);
+    }
+    for (int j = 0; j < (int)_header.z_size; j++)
+    {
+      z[i*_header.z_size+j] = ind->get_z(j);
+    }
+    dmu[i] = ind->get_dmu();
+    dz[i]  = ind->get_dz();
+    Wmu[i] = ind->get_Wmu();
+    Wz[i]  = ind->get_Wz();
+  }
+}
+
+/**
+ * \brief    Write a binary snapshot of the population
+ * \details  The whole population is gathered in the snapshot buffer, which is
+ *           then written to output/population_<generation>.bin at once
+ * \param    Population* population
+ * \param    int generation
+ * \return   \e void
+ */
+void Snapshot::write_snapshot( Population* population, int generation )
+{
+  INSTRUMENT_SCOPE(TRACE_WRITE_SNAPSHOT);
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Gather the population      */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  gather(population, generation);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Write the snapshot file    */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::stringstream filename;
+  filename << _parameters->get_output_filename("output") << "/population_" << generation << ".bin";
+  std::ofstream file(filename.str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file)
+  {
+    printf("Error in Snapshot::write_snapshot(): impossible to open file %s. Exit.\n", filename.str().c_str());
+    exit(EXIT_FAILURE);
+  }
+  file.write(_buffer, (std::streamsize)_header.file_size);
+  file.close();
+}
+
+/*----------------------------
+ * PROTECTED METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Align an offset on SNAPSHOT_ALIGNMENT bytes
+ * \details  --
+ * \param    unsigned long long int offset
+ * \return   \e unsigned long long int
+ */
+unsigned long long int Snapshot::align( unsigned long long int offset ) const
+{
+  return ((offset+SNAPSHOT_ALIGNMENT-1)/SNAPSHOT_ALIGNMENT)*SNAPSHOT_ALIGNMENT;
+}
@@ -0,0 +1,151 @@
+
+/**
+ * \file      Snapshot.h
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Snapshot class declaration
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#ifndef __SigmaFGM__Snapshot__
+#define __SigmaFGM__Snapshot__
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <sys/stat.h>
+#include <assert.h>
+
+#include "Macros.h"
+#include "Enums.h"
+#include "Structs.h"
+#include "Parameters.h"
+#include "Population.h"
+#include "Instrumentation.h"
+
+
+class Snapshot
+{
+  
+public:
+  
+  /*----------------------------
+   * CONSTRUCTORS
+   *----------------------------*/
+  Snapshot( void ) = delete;
+  Snapshot( Parameters* parameters );
+  Snapshot( const Snapshot& snapshot ) = delete;
+  
+  /*----------------------------
+   * DESTRUCTORS
+   *----------------------------*/
+  ~Snapshot( void );
+  
+  /*----------------------------
+   * GETTERS
+   *----------------------------*/
+  inline bool                   is_snapshot_generation( int generation ) const;
+  inline const snapshot_header* get_header( void ) const;
+  inline const char*            get_buffer( void ) const;
+  
+  /*----------------------------
+   * SETTERS
+   *----------------------------*/
+  Snapshot& operator=(const Snapshot&) = delete;
+  
+  /*----------------------------
+   * PUBLIC METHODS
+   *----------------------------*/
+  void gather( Population* population, int generation );
+  void write_snapshot( Population* population, int generation );
+  
+  /*----------------------------
+   * PUBLIC ATTRIBUTES
+   *----------------------------*/
+  
+protected:
+  
+  /*----------------------------
+   * PROTECTED METHODS
+   *----------------------------*/
+  unsigned long long int align( unsigned long long int offset ) const;
+  
+  /*----------------------------
+   * PROTECTED ATTRIBUTES
+   *----------------------------*/
+  
+  /*----------------------------------------------- PARAMETERS */
+  
+  Parameters* _parameters; /*!< Parameters */
+  
+  /*----------------------------------------------- SNAPSHOT LAYOUT */
+  
+  snapshot_header _header; /*!< Snapshot header (identical for every generation but the generation field) */
+  char*           _buffer; /*!< Snapshot buffer, reused at every snapshot (NULL before the first gather)   */
+};
+
+
+/*----------------------------
+ * GETTERS
+ *----------------------------*/
+
+/**
+ * \brief    Check if a snapshot must be written at this generation
+ * \details  --
+ * \param    int generation
+ * \return   \e bool
+ */
+inline bool Snapshot::is_snapshot_generation( int generation ) const
+{
+  return (_parameters->get_snapshot_interval() > 0 && generation%_parameters->get_snapshot_interval() == 0);
+}
+
+/**
+ * \brief    Get the snapshot header
+ * \details  --
+ * \param    void
+ * \return   \e const snapshot_header*
+ */
+inline const snapshot_header* Snapshot::get_header( void ) const
+{
+  return &_header;
+}
+
+/**
+ * \brief    Get the snapshot buffer
+ * \details  Block offsets are given by the header. The buffer is allocated by the first gather
+ * \param    void
+ * \return   \e const char* (NULL before the first gather)
+ */
+inline const char* Snapshot::get_buffer( void ) const
+{
+  return _buffer;
+}
+
+/*----------------------------
+ * SETTERS
+ *----------------------------*/
+
+
+#endif /* defined(__SigmaFGM__Snapshot__) */
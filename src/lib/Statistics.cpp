@@ -35,13 +35,14 @@
  *----------------------------*/
 
 /**
- * \brief    Default constructor
- * \details  --
- * \param    void
+ * \brief    Constructor
+ * \details  Statistic files are created in the output path, unless file output is disabled
+ * \param    Parameters* parameters
  * \return   \e void
  */
-Statistics::Statistics( void )
+Statistics::Statistics( Parameters* parameters )
 {
+  assert(parameters != NULL);
   
   /*----------------------------------------------- MEAN VALUES */
   
@@ -71,8 +72,50 @@ Statistics::Statistics( void )
   
   /*----------------------------------------------- STATISTIC FILES */
   
-  _mean_file.open("mean.txt", std::ios::out | std::ios::trunc);
-  _sd_file.open("sd.txt", std::ios::out | std::ios::trunc);
+  if (parameters->get_file_output())
+  {
+    _mean_file.open(parameters->get_output_filename("mean.txt").c_str(), std::ios::out | std::ios::trunc);
+    _sd_file.open(parameters->get_output_filename("sd.txt").c_str(), std::ios::out | std::ios::trunc);
+  }
+}
+
+/**
+ * \brief    Constructor from backup file
+ * \details  Statistic files are truncated to the length they had when the checkpoint was saved, and reopened at their end.
+ *           If nothing was written yet (e.g. checkpoint saved during stabilization), files are created
+ *
+ * \param    Parameters* parameters
+ * \param    std::ifstream& backup_file
+ * \return   \e void
+ */
+Statistics::Statistics( Parameters* parameters, std::ifstream& backup_file )
+{
+  assert(parameters != NULL);
+  reset();
+  
+  /*----------------------------------------------- STATISTIC FILES */
+  
+  std::string   mean_filename = parameters->get_output_filename("mean.txt");
+  std::string   sd_filename   = parameters->get_output_filename("sd.txt");
+  long long int mean_offset   = 0;
+  long long int sd_offset     = 0;
+  backup_file.read((char*)&mean_offset, sizeof(mean_offset));
+  backup_file.read((char*)&sd_offset, sizeof(sd_offset));
+  if (mean_offset == 0 && sd_offset == 0)
+  {
+    _mean_file.open(mean_filename.c_str(), std::ios::out | std::ios::trunc);
+    _sd_file.open(sd_filename.c_str(), std::ios::out | std::ios::trunc);
+    return;
+  }
+  if (truncate(mean_filename.c_str(), (off_t)mean_offset) != 0 || truncate(sd_filename.c_str(), (off_t)sd_offset) != 0)
+  {
+    printf("Error in Statistics::Statistics(): statistic files of the checkpointed simulation are missing. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  _mean_file.open(mean_filename.c_str(), std::ios::in | std::ios::out);
+  _sd_file.open(sd_filename.c_str(), std::ios::in | std::ios::out);
+  _mean_file.seekp(0, std::ios::end);
+  _sd_file.seekp(0, std::ios::end);
 }
 
 /*----------------------------
@@ -102,6 +145,10 @@ Statistics::~Statistics( void )
  */
 void Statistics::write_headers( void )
 {
+  if (!_mean_file.is_open())
+  {
+    return;
+  }
   
   /*----------------------------------------------- MEAN VALUES */
   
@@ -140,38 +187,61 @@ void Statistics::write_headers( void )
  */
 void Statistics::compute_statistics( Population* population )
 {
+  INSTRUMENT_SCOPE(TRACE_STATISTICS);
   for (int i = 0; i < population->get_population_size(); i++)
   {
-    Individual* ind = population->get_individual(i);
-    
-    /*----------------------------------------------- MEAN VALUES */
-    
-    _dmu_mean             += ind->get_dmu();
-    _dz_mean              += ind->get_dz();
-    _Wmu_mean             += ind->get_Wmu();
-    _Wz_mean              += ind->get_Wz();
-    _EV_mean              += ind->get_max_Sigma_eigenvalue();
-    _EV_contribution_mean += ind->get_max_Sigma_contribution();
-    _EV_dot_product_mean  += ind->get_max_dot_product();
-    _r_mu_mean            += ind->get_r_mu();
-    _r_sigma_mean         += ind->get_r_sigma();
-    _r_theta_mean         += ind->get_r_theta();
-    
-    /*----------------------------------------------- STANDARD DEVIATION VALUES */
-    
-    _dmu_sd             += ind->get_dmu()*ind->get_dmu();
-    _dz_sd              += ind->get_dz()*ind->get_dz();
-    _Wmu_sd             += ind->get_Wmu()*ind->get_Wmu();
-    _Wz_sd              += ind->get_Wz()*ind->get_Wz();
-    _EV_sd              += ind->get_max_Sigma_eigenvalue()*ind->get_max_Sigma_eigenvalue();
-    _EV_contribution_sd += ind->get_max_Sigma_contribution()*ind->get_max_Sigma_contribution();
-    _EV_dot_product_sd  += ind->get_max_dot_product()*ind->get_max_dot_product();
-    _r_mu_sd            += ind->get_r_mu()*ind->get_r_mu();
-    _r_sigma_sd         += ind->get_r_sigma()*ind->get_r_sigma();
-    _r_theta_sd         += ind->get_r_theta()*ind->get_r_theta();
+    add_individual(population->get_individual(i));
   }
+  complete_statistics(population->get_population_size());
+}
+
+/**
+ * \brief    Add an individual to the statistics
+ * \details  Statistics must be reset first, and completed once every individual has been added. The mapping properties
+ *           of the individual are computed if needed
+ * \param    Individual* ind
+ * \return   \e void
+ */
+void Statistics::add_individual( Individual* ind )
+{
+  ind->compute_diagnostics();
+  
+  /*----------------------------------------------- MEAN VALUES */
   
-  double N = (double)population->get_population_size();
+  _dmu_mean             += ind->get_dmu();
+  _dz_mean              += ind->get_dz();
+  _Wmu_mean             += ind->get_Wmu();
+  _Wz_mean              += ind->get_Wz();
+  _EV_mean              += ind->get_max_Sigma_eigenvalue();
+  _EV_contribution_mean += ind->get_max_Sigma_contribution();
+  _EV_dot_product_mean  += ind->get_max_dot_product();
+  _r_mu_mean            += ind->get_r_mu();
+  _r_sigma_mean         += ind->get_r_sigma();
+  _r_theta_mean         += ind->get_r_theta();
+  
+  /*----------------------------------------------- STANDARD DEVIATION VALUES */
+  
+  _dmu_sd             += ind->get_dmu()*ind->get_dmu();
+  _dz_sd              += ind->get_dz()*ind->get_dz();
+  _Wmu_sd             += ind->get_Wmu()*ind->get_Wmu();
+  _Wz_sd              += ind->get_Wz()*ind->get_Wz();
+  _EV_sd              += ind->get_max_Sigma_eigenvalue()*ind->get_max_Sigma_eigenvalue();
+  _EV_contribution_sd += ind->get_max_Sigma_contribution()*ind->get_max_Sigma_contribution();
+  _EV_dot_product_sd  += ind->get_max_dot_product()*ind->get_max_dot_product();
+  _r_mu_sd            += ind->get_r_mu()*ind->get_r_mu();
+  _r_sigma_sd         += ind->get_r_sigma()*ind->get_r_sigma();
+  _r_theta_sd         += ind->get_r_theta()*ind->get_r_theta();
+}
+
+/**
+ * \brief    Complete the statistics once every individual has been added
+ * \details  --
+ * \param    int population_size
+ * \return   \e void
+ */
+void Statistics::complete_statistics( int population_size )
+{
+  double N = (double)population_size;
   
   /*----------------------------------------------- MEAN VALUES */
   
@@ -292,12 +362,18 @@ void Statistics::compute_statistics( Population* population )
 
 /**
  * \brief    Write statistics
- * \details  --
+ * \details  Nothing is written if file output is disabled
  * \param    int generation
  * \return   \e void
  */
 void Statistics::write_statistics( int generation )
 {
+  if (!_mean_file.is_open())
+  {
+    return;
+  }
+  INSTRUMENT_SCOPE(TRACE_WRITE_STATISTICS);
+  
   /*----------------------------------------------- MEAN VALUES */
   
   _mean_file << generation << " ";
@@ -386,6 +462,36 @@ void Statistics::close( void )
   _sd_file.close();
 }
 
+/**
+ * \brief    Save the length of statistic files in a backup file
+ * \details  Statistic files are flushed first
+ * \param    std::ofstream& backup_file
+ * \return   \e void
+ */
+void Statistics::save( std::ofstream& backup_file )
+{
+  flush();
+  long long int mean_offset = (long long int)_mean_file.tellp();
+  long long int sd_offset   = (long long int)_sd_file.tellp();
+  backup_file.write((char*)&mean_offset, sizeof(mean_offset));
+  backup_file.write((char*)&sd_offset, sizeof(sd_offset));
+}
+
+/**
+ * \brief    List the output files a simulation resumed from a backup of the statistics reopens
+ * \details  File names are relative to the output path. Statistic files are only reopened if something was written in them
+ * \param    std::vector<std::string>& filenames
+ * \return   \e void
+ */
+void Statistics::get_resumed_files( std::vector<std::string>& filenames )
+{
+  if (_mean_file.tellp() != 0 || _sd_file.tellp() != 0)
+  {
+    filenames.push_back("mean.txt");
+    filenames.push_back("sd.txt");
+  }
+}
+
 /*----------------------------
  * PROTECTED METHODS
  *----------------------------*/
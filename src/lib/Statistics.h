@@ -32,9 +32,14 @@
 
 #include <iostream>
 #include <fstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
 #include <assert.h>
 
+#include "Parameters.h"
 #include "Population.h"
+#include "Instrumentation.h"
 
 
 class Statistics
@@ -45,7 +50,9 @@ public:
   /*----------------------------
    * CONSTRUCTORS
    *----------------------------*/
-  Statistics( void );
+  Statistics( void ) = delete;
+  Statistics( Parameters* parameters );
+  Statistics( Parameters* parameters, std::ifstream& backup_file );
   Statistics( const Statistics& statistics ) = delete;
   
   /*----------------------------
@@ -60,6 +67,22 @@ public:
   inline double get_dz_mean( void ) const;
   inline double get_Wmu_mean( void ) const;
   inline double get_Wz_mean( void ) const;
+  inline double get_EV_mean( void ) const;
+  inline double get_EV_contribution_mean( void ) const;
+  inline double get_EV_dot_product_mean( void ) const;
+  inline double get_r_mu_mean( void ) const;
+  inline double get_r_sigma_mean( void ) const;
+  inline double get_r_theta_mean( void ) const;
+  inline double get_dmu_sd( void ) const;
+  inline double get_dz_sd( void ) const;
+  inline double get_Wmu_sd( void ) const;
+  inline double get_Wz_sd( void ) const;
+  inline double get_EV_sd( void ) const;
+  inline double get_EV_contribution_sd( void ) const;
+  inline double get_EV_dot_product_sd( void ) const;
+  inline double get_r_mu_sd( void ) const;
+  inline double get_r_sigma_sd( void ) const;
+  inline double get_r_theta_sd( void ) const;
   
   /*----------------------------
    * SETTERS
@@ -71,10 +94,14 @@ public:
    *----------------------------*/
   void write_headers( void );
   void compute_statistics( Population* population );
+  void add_individual( Individual* ind );
+  void complete_statistics( int population_size );
   void write_statistics( int generation );
   void reset( void );
   void flush( void );
   void close( void );
+  void save( std::ofstream& backup_file );
+  void get_resumed_files( std::vector<std::string>& filenames );
   
   /*----------------------------
    * PUBLIC ATTRIBUTES
@@ -171,6 +198,182 @@ inline double Statistics::get_Wz_mean( void ) const
   return _Wz_mean;
 }
 
+/**
+ * \brief    Get mean best eigen value
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_EV_mean( void ) const
+{
+  return _EV_mean;
+}
+
+/**
+ * \brief    Get mean best eigen value contribution
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_EV_contribution_mean( void ) const
+{
+  return _EV_contribution_mean;
+}
+
+/**
+ * \brief    Get mean best dot product
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_EV_dot_product_mean( void ) const
+{
+  return _EV_dot_product_mean;
+}
+
+/**
+ * \brief    Get mean euclidean size of mu mutation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_r_mu_mean( void ) const
+{
+  return _r_mu_mean;
+}
+
+/**
+ * \brief    Get mean euclidean size of sigma mutation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_r_sigma_mean( void ) const
+{
+  return _r_sigma_mean;
+}
+
+/**
+ * \brief    Get mean euclidean size of theta mutation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_r_theta_mean( void ) const
+{
+  return _r_theta_mean;
+}
+
+/**
+ * \brief    Get genetic distance standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_dmu_sd( void ) const
+{
+  return _dmu_sd;
+}
+
+/**
+ * \brief    Get phenotypic distance standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_dz_sd( void ) const
+{
+  return _dz_sd;
+}
+
+/**
+ * \brief    Get genetic fitness standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_Wmu_sd( void ) const
+{
+  return _Wmu_sd;
+}
+
+/**
+ * \brief    Get phenotypic fitness standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_Wz_sd( void ) const
+{
+  return _Wz_sd;
+}
+
+/**
+ * \brief    Get best eigen value standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_EV_sd( void ) const
+{
+  return _EV_sd;
+}
+
+/**
+ * \brief    Get best eigen value contribution standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_EV_contribution_sd( void ) const
+{
+  return _EV_contribution_sd;
+}
+
+/**
+ * \brief    Get best dot product standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_EV_dot_product_sd( void ) const
+{
+  return _EV_dot_product_sd;
+}
+
+/**
+ * \brief    Get mu mutation size standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_r_mu_sd( void ) const
+{
+  return _r_mu_sd;
+}
+
+/**
+ * \brief    Get sigma mutation size standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_r_sigma_sd( void ) const
+{
+  return _r_sigma_sd;
+}
+
+/**
+ * \brief    Get theta mutation size standard deviation
+ * \details  --
+ * \param    void
+ * \return   \e double
+ */
+inline double Statistics::get_r_theta_sd( void ) const
+{
+  return _r_theta_sd;
+}
+
 /*----------------------------
  * SETTERS
  *----------------------------*/
@@ -36,4 +36,115 @@
 #include "Enums.h"
 
 
+/**
+ * \brief   Population snapshot header
+ * \details Fixed-size header at the beginning of a binary population snapshot.
+ *          Every data block is stored row-major (one row per individual) and
+ *          starts at a byte offset aligned on SNAPSHOT_ALIGNMENT, so that the
+ *          file can be memory-mapped and read as plain arrays.
+ */
+typedef struct
+{
+  char                   magic[8];             /*!< File signature ("SFGMSNAP")                           */
+  unsigned int           version;              /*!< Format version                                        */
+  unsigned int           header_size;          /*!< Size of the header in bytes                           */
+  long long int          generation;           /*!< Generation of the snapshot                            */
+  long long int          population_size;      /*!< Number of individuals (rows)                          */
+  long long int          number_of_dimensions; /*!< Number of dimensions n                                */
+  long long int          noise_type;           /*!< Type of phenotypic noise                              */
+  long long int          mu_size;              /*!< Number of mu values per individual (n)                */
+  long long int          sigma_size;           /*!< Number of sigma values per individual (0 or n)        */
+  long long int          theta_size;           /*!< Number of theta values per individual (0 or n(n-1)/2) */
+  long long int          z_size;               /*!< Number of z values per individual (n)                 */
+  unsigned long long int identifier_offset;    /*!< Offset of the identifiers block (uint64)              */
+  unsigned long long int mu_offset;            /*!< Offset of the mu block (double)                       */
+  unsigned long long int sigma_offset;         /*!< Offset of the sigma block (double)                    */
+  unsigned long long int theta_offset;         /*!< Offset of the theta block (double)                    */
+  unsigned long long int z_offset;             /*!< Offset of the z block (double)                        */
+  unsigned long long int dmu_offset;           /*!< Offset of the d(mu) block (double)                    */
+  unsigned long long int dz_offset;            /*!< Offset of the d(z) block (double)                     */
+  unsigned long long int Wmu_offset;           /*!< Offset of the W(mu) block (double)                    */
+  unsigned long long int Wz_offset;            /*!< Offset of the W(z) block (double)                     */
+  unsigned long long int file_size;            /*!< Total size of the file in bytes                       */
+} snapshot_header;
+
+/**
+ * \brief   Lineage tree node handle
+ * \details Position of a node in the lineage tree. The stamp is the number of
+ *          compactions of the generation when the handle was created: a handle
+ *          is invalidated as soon as its generation is compacted again.
+ */
+typedef struct
+{
+  int          generation; /*!< Generation of the node             */
+  int          index;      /*!< Index of the node in the generation */
+  unsigned int stamp;      /*!< Compaction stamp of the generation  */
+} node_handle;
+
+/**
+ * \brief   Line of descent record
+ * \details Statistics of an individual reported in the line of descent.
+ */
+typedef struct
+{
+  double dmu;            /*!< Mean phenotype distance to the optimum           */
+  double dz;             /*!< Phenotype distance to the optimum                */
+  double Wmu;            /*!< Mean phenotype fitness                           */
+  double Wz;             /*!< Phenotype fitness                                */
+  double EV;             /*!< Maximum eigenvalue of the covariance matrix      */
+  double EV_contrib;     /*!< Contribution of the maximum eigenvalue           */
+  double EV_dot_product; /*!< Alignment of the main eigenvector to the optimum */
+  double r_mu;           /*!< Mutation size on mu                              */
+  double r_sigma;        /*!< Mutation size on sigma                           */
+  double r_theta;        /*!< Mutation size on theta                           */
+} lod_record;
+
+/**
+ * \brief   Instrumentation trace header
+ * \details Fixed-size header at the beginning of an instrumentation trace. It
+ *          is followed by one trace_zone_descriptor per zone, then by the
+ *          trace_record of every generation.
+ */
+typedef struct
+{
+  char         magic[8];          /*!< File signature ("SFGMTRCE")                   */
+  unsigned int version;           /*!< Format version                                */
+  unsigned int number_of_zones;   /*!< Number of zone descriptors that follow        */
+  unsigned int hardware_counters; /*!< 1 if the records hold hardware counters       */
+  unsigned int padding;           /*!< Unused                                        */
+} trace_header;
+
+/**
+ * \brief   Instrumentation trace zone descriptor
+ * \details --
+ */
+typedef struct
+{
+  char          name[24]; /*!< Zone name                                       */
+  long long int timed;    /*!< 1 if the zone is a timed scope, 0 for a counter */
+} trace_zone_descriptor;
+
+/**
+ * \brief   Instrumentation trace record
+ * \details Activity of a zone during a generation. Times are in microseconds
+ *          since the creation of the trace. Counters only have calls, and
+ *          allocations are only counted on glibc. Zones are inclusive: the
+ *          allocations of a phase include those of its nested phases. Hardware
+ *          counters are zero unless built WITH_HARDWARE_COUNTERS.
+ */
+typedef struct
+{
+  long long int          phase;                 /*!< Simulation phase (values of simulation_phase)  */
+  long long int          generation;            /*!< Generation                                     */
+  long long int          zone;                  /*!< Zone (values of trace_zone)                    */
+  double                 start;                 /*!< First entry in the zone                        */
+  double                 end;                   /*!< Last exit from the zone                        */
+  double                 busy;                  /*!< Time spent in the zone                         */
+  unsigned long long int calls;                 /*!< Number of calls (or of events for a counter)   */
+  unsigned long long int allocations;           /*!< Heap allocations in the zone                   */
+  unsigned long long int bytes;                 /*!< Bytes allocated in the zone                    */
+  unsigned long long int counters[HW_COUNTERS]; /*!< Hardware counters (values of hardware_counter) */
+} trace_record;
+
+
 #endif /* defined(__SigmaFGM__Structs__) */
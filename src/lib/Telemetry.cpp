@@ -0,0 +1,158 @@
+
+/**
+ * \file      Telemetry.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Telemetry class definition
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "Telemetry.h"
+
+
+/*----------------------------
+ * CONSTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Constructor
+ * \details  The telemetry file is created in the output path. A resumed simulation appends its reports to the existing file
+ * \param    Parameters* parameters
+ * \param    bool append
+ * \return   \e void
+ */
+Telemetry::Telemetry( Parameters* parameters, bool append )
+{
+  assert(parameters != NULL);
+  assert(parameters->get_telemetry_interval() > 0);
+  
+  /*----------------------------------------------- PARAMETERS */
+  
+  _interval        = parameters->get_telemetry_interval();
+  _population_size = parameters->get_population_size();
+  
+  /*----------------------------------------------- MEASURES */
+  
+  _origin                = std::chrono::steady_clock::now();
+  _last_report_time      = 0.0;
+  _number_of_generations = 0;
+  memset(_phase_times, 0, sizeof(double)*TELEMETRY_PHASES);
+  _reproduction_time     = 0.0;
+  
+  /*----------------------------------------------- TELEMETRY FILE */
+  
+  std::string filename = parameters->get_output_filename(TELEMETRY_FILE);
+  _file.open(filename.c_str(), (append ? std::ios::out | std::ios::app : std::ios::out | std::ios::trunc));
+  if (append)
+  {
+    return;
+  }
+  _file << "phase" << " ";
+  _file << "g" << " ";
+  _file << "time" << " ";
+  _file << "generations_per_s" << " ";
+  _file << "individuals_per_s" << " ";
+  _file << "resampling_ms" << " ";
+  _file << "mutation_ms" << " ";
+  _file << "phenotype_ms" << " ";
+  _file << "fitness_ms" << " ";
+  _file << "statistics_ms" << " ";
+  _file << "output_ms" << " ";
+  _file << "peak_rss_MB" << "\n";
+  _file.flush();
+}
+
+/*----------------------------
+ * DESTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Destructor
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+Telemetry::~Telemetry( void )
+{
+  _file.close();
+}
+
+/*----------------------------
+ * PUBLIC METHODS
+ *----------------------------*/
+
+/**
+ * \brief    End a generation
+ * \details  Every interval, a report is written with the throughput and the mean time per generation of each phase since
+ *           the last report (mutation, phenotype and fitness times are estimated on sampled offspring)
+ * \param    simulation_phase phase
+ * \param    int generation
+ * \return   \e void
+ */
+void Telemetry::end_generation( simulation_phase phase, int generation )
+{
+  _number_of_generations++;
+  if (generation%_interval != 0)
+  {
+    return;
+  }
+  double now     = get_time();
+  double elapsed = now-_last_report_time;
+  _phase_times[RESAMPLING] = _reproduction_time-_phase_times[MUTATION]-_phase_times[PHENOTYPE]-_phase_times[FITNESS];
+  if (_phase_times[RESAMPLING] < 0.0)
+  {
+    _phase_times[RESAMPLING] = 0.0;
+  }
+  _file << (phase == STABILIZATION ? "stabilization" : "evolution") << " ";
+  _file << generation << " ";
+  _file << now << " ";
+  _file << (elapsed > 0.0 ? _number_of_generations/elapsed : 0.0) << " ";
+  _file << (elapsed > 0.0 ? (double)_number_of_generations*_population_size/elapsed : 0.0) << " ";
+  for (int i = 0; i < TELEMETRY_PHASES; i++)
+  {
+    _file << 1000.0*_phase_times[i]/_number_of_generations << " ";
+  }
+  _file << get_peak_rss() << "\n";
+  _file.flush();
+  _last_report_time      = now;
+  _number_of_generations = 0;
+  memset(_phase_times, 0, sizeof(double)*TELEMETRY_PHASES);
+  _reproduction_time     = 0.0;
+}
+
+/*----------------------------
+ * PROTECTED METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Get the peak resident set size of the process
+ * \details  Shared by all the simulations of the process (e.g. in batch mode)
+ * \param    void
+ * \return   \e double (MB)
+ */
+double Telemetry::get_peak_rss( void ) const
+{
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss/1024.0;
+}
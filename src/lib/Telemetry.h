@@ -0,0 +1,180 @@
+
+/**
+ * \file      Telemetry.h
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Telemetry class declaration
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#ifndef __SigmaFGM__Telemetry__
+#define __SigmaFGM__Telemetry__
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstring>
+#include <sys/resource.h>
+#include <assert.h>
+
+#include "Macros.h"
+#include "Enums.h"
+#include "Parameters.h"
+
+
+class Telemetry
+{
+  
+public:
+  
+  /*----------------------------
+   * CONSTRUCTORS
+   *----------------------------*/
+  Telemetry( void ) = delete;
+  Telemetry( Parameters* parameters, bool append );
+  Telemetry( const Telemetry& telemetry ) = delete;
+  
+  /*----------------------------
+   * DESTRUCTORS
+   *----------------------------*/
+  ~Telemetry( void );
+  
+  /*----------------------------
+   * GETTERS
+   *----------------------------*/
+  inline double get_time( void ) const;
+  
+  /*----------------------------
+   * SETTERS
+   *----------------------------*/
+  Telemetry& operator=(const Telemetry&) = delete;
+  
+  /*----------------------------
+   * PUBLIC METHODS
+   *----------------------------*/
+  inline void add_phase_time( telemetry_phase phase, double& time );
+  inline void add_sampled_phase_time( telemetry_phase phase, double& time );
+  inline void add_reproduction_time( double& time );
+  void        end_generation( simulation_phase phase, int generation );
+  
+  /*----------------------------
+   * PUBLIC ATTRIBUTES
+   *----------------------------*/
+  
+protected:
+  
+  /*----------------------------
+   * PROTECTED METHODS
+   *----------------------------*/
+  double get_peak_rss( void ) const;
+  
+  /*----------------------------
+   * PROTECTED ATTRIBUTES
+   *----------------------------*/
+  
+  /*----------------------------------------------- PARAMETERS */
+  
+  int _interval;        /*!< Number of generations between reports */
+  int _population_size; /*!< Number of individuals per generation   */
+  
+  /*----------------------------------------------- MEASURES */
+  
+  std::chrono::steady_clock::time_point _origin;                        /*!< Creation time                                  */
+  double                                _last_report_time;              /*!< Time of the last report (s)                    */
+  int                                   _number_of_generations;         /*!< Generations computed since the last report     */
+  double                                _phase_times[TELEMETRY_PHASES]; /*!< Time spent in each phase since the last report */
+  double                                _reproduction_time;             /*!< Time spent computing the offspring             */
+  
+  /*----------------------------------------------- TELEMETRY FILE */
+  
+  std::ofstream _file; /*!< Telemetry file */
+};
+
+
+/*----------------------------
+ * GETTERS
+ *----------------------------*/
+
+/**
+ * \brief    Get the time elapsed since the creation of the telemetry
+ * \details  Monotonic clock, in seconds
+ * \param    void
+ * \return   \e double
+ */
+inline double Telemetry::get_time( void ) const
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()-_origin).count();
+}
+
+/*----------------------------
+ * SETTERS
+ *----------------------------*/
+
+/*----------------------------
+ * PUBLIC METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Add the time elapsed since time to a phase
+ * \details  time is set to the current time, so that consecutive phases can be chained
+ * \param    telemetry_phase phase
+ * \param    double& time
+ * \return   \e void
+ */
+inline void Telemetry::add_phase_time( telemetry_phase phase, double& time )
+{
+  double now           = get_time();
+  _phase_times[phase] += now-time;
+  time                 = now;
+}
+
+/**
+ * \brief    Add the time elapsed since time to a phase, for a sampled offspring
+ * \details  Only one offspring out of TELEMETRY_SAMPLING is timed, so that reading the clock stays cheap: its time is
+ *           weighted accordingly
+ * \param    telemetry_phase phase
+ * \param    double& time
+ * \return   \e void
+ */
+inline void Telemetry::add_sampled_phase_time( telemetry_phase phase, double& time )
+{
+  double now           = get_time();
+  _phase_times[phase] += (now-time)*TELEMETRY_SAMPLING;
+  time                 = now;
+}
+
+/**
+ * \brief    Add the time elapsed since time to the reproduction
+ * \details  The resampling time is what remains of the reproduction time once sampled phases are removed
+ * \param    double& time
+ * \return   \e void
+ */
+inline void Telemetry::add_reproduction_time( double& time )
+{
+  double now          = get_time();
+  _reproduction_time += now-time;
+  time                = now;
+}
+
+
+#endif /* defined(__SigmaFGM__Telemetry__) */
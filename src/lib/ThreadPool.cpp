@@ -0,0 +1,211 @@
+
+/**
+ * \file      ThreadPool.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     ThreadPool class definition
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "ThreadPool.h"
+
+
+/*----------------------------
+ * CONSTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Constructor
+ * \details  Starts the worker threads
+ * \param    int number_of_threads
+ * \return   \e void
+ */
+ThreadPool::ThreadPool( int number_of_threads )
+{
+  assert(number_of_threads > 0);
+  
+  /*----------------------------------------------- TASK QUEUES */
+  
+  _number_of_threads = number_of_threads;
+  _queues            = new std::deque< std::function<void()> >[_number_of_threads];
+  _queue_mutexes     = new std::mutex[_number_of_threads];
+  _queued            = 0;
+  _next_queue        = 0;
+  
+  /*----------------------------------------------- SYNCHRONIZATION */
+  
+  _pending = 0;
+  _stop    = false;
+  
+  /*----------------------------------------------- WORKERS */
+  
+  for (int i = 0; i < _number_of_threads; i++)
+  {
+    _workers.push_back(std::thread(&ThreadPool::work, this, i));
+  }
+}
+
+/*----------------------------
+ * DESTRUCTORS
+ *----------------------------*/
+
+/**
+ * \brief    Destructor
+ * \details  Waits for the remaining tasks, then joins the worker threads
+ * \param    void
+ * \return   \e void
+ */
+ThreadPool::~ThreadPool( void )
+{
+  wait();
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _task_available.notify_all();
+  for (size_t i = 0; i < _workers.size(); i++)
+  {
+    _workers[i].join();
+  }
+  delete[] _queues;
+  _queues = NULL;
+  delete[] _queue_mutexes;
+  _queue_mutexes = NULL;
+}
+
+/*----------------------------
+ * PUBLIC METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Submit a task
+ * \details  Tasks are distributed round-robin on the worker queues. Idle workers steal tasks from the other queues
+ * \param    std::function<void()> task
+ * \return   \e void
+ */
+void ThreadPool::submit( std::function<void()> task )
+{
+  int index = 0;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    index       = _next_queue;
+    _next_queue = (_next_queue+1)%_number_of_threads;
+    _pending++;
+  }
+  {
+    std::lock_guard<std::mutex> lock(_queue_mutexes[index]);
+    _queues[index].push_back(task);
+  }
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queued++;
+  }
+  _task_available.notify_one();
+}
+
+/**
+ * \brief    Wait until every submitted task is finished
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void ThreadPool::wait( void )
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _all_done.wait(lock, [this]{ return _pending == 0; });
+}
+
+/*----------------------------
+ * PROTECTED METHODS
+ *----------------------------*/
+
+/**
+ * \brief    Worker loop
+ * \details  --
+ * \param    int index
+ * \return   \e void
+ */
+void ThreadPool::work( int index )
+{
+  std::function<void()> task;
+  while (true)
+  {
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    /* 1) Run a task from any queue         */
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    if (pop_task(index, task))
+    {
+      task();
+      task = nullptr;
+      std::lock_guard<std::mutex> lock(_mutex);
+      _pending--;
+      if (_pending == 0)
+      {
+        _all_done.notify_all();
+      }
+      continue;
+    }
+    
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    /* 2) Else sleep until a task is queued */
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+    std::unique_lock<std::mutex> lock(_mutex);
+    _task_available.wait(lock, [this]{ return _stop || _queued > 0; });
+    if (_stop && _queued == 0)
+    {
+      return;
+    }
+  }
+}
+
+/**
+ * \brief    Pop a task for the worker index
+ * \details  The worker takes the oldest task of its own queue first, then steals the newest task of another queue
+ * \param    int index
+ * \param    std::function<void()>& task
+ * \return   \e bool (false if all the queues are empty)
+ */
+bool ThreadPool::pop_task( int index, std::function<void()>& task )
+{
+  for (int i = 0; i < _number_of_threads; i++)
+  {
+    int                         victim = (index+i)%_number_of_threads;
+    std::lock_guard<std::mutex> lock(_queue_mutexes[victim]);
+    if (!_queues[victim].empty())
+    {
+      if (victim == index)
+      {
+        task = _queues[victim].front();
+        _queues[victim].pop_front();
+      }
+      else
+      {
+        task = _queues[victim].back();
+        _queues[victim].pop_back();
+      }
+      _queued--;
+      return true;
+    }
+  }
+  return false;
+}
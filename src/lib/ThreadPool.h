@@ -0,0 +1,137 @@
+
+/**
+ * \file      ThreadPool.h
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     ThreadPool class declaration
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#ifndef __SigmaFGM__ThreadPool__
+#define __SigmaFGM__ThreadPool__
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <assert.h>
+
+#include "Macros.h"
+
+
+class ThreadPool
+{
+  
+public:
+  
+  /*----------------------------
+   * CONSTRUCTORS
+   *----------------------------*/
+  ThreadPool( void ) = delete;
+  ThreadPool( int number_of_threads );
+  ThreadPool( const ThreadPool& thread_pool ) = delete;
+  
+  /*----------------------------
+   * DESTRUCTORS
+   *----------------------------*/
+  ~ThreadPool( void );
+  
+  /*----------------------------
+   * GETTERS
+   *----------------------------*/
+  inline int get_number_of_threads( void ) const;
+  
+  /*----------------------------
+   * SETTERS
+   *----------------------------*/
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  
+  /*----------------------------
+   * PUBLIC METHODS
+   *----------------------------*/
+  void submit( std::function<void()> task );
+  void wait( void );
+  
+  /*----------------------------
+   * PUBLIC ATTRIBUTES
+   *----------------------------*/
+  
+protected:
+  
+  /*----------------------------
+   * PROTECTED METHODS
+   *----------------------------*/
+  void work( int index );
+  bool pop_task( int index, std::function<void()>& task );
+  
+  /*----------------------------
+   * PROTECTED ATTRIBUTES
+   *----------------------------*/
+  
+  /*----------------------------------------------- WORKERS */
+  
+  int                      _number_of_threads; /*!< Number of worker threads */
+  std::vector<std::thread> _workers;           /*!< Worker threads           */
+  
+  /*----------------------------------------------- TASK QUEUES */
+  
+  std::deque< std::function<void()> >* _queues;        /*!< One task queue per worker               */
+  std::mutex*                          _queue_mutexes; /*!< One mutex per task queue                */
+  std::atomic<int>                     _queued;        /*!< Number of tasks waiting in the queues   */
+  int                                  _next_queue;    /*!< Queue receiving the next submitted task */
+  
+  /*----------------------------------------------- SYNCHRONIZATION */
+  
+  std::mutex              _mutex;          /*!< Mutex protecting the pool state                */
+  std::condition_variable _task_available; /*!< Signals workers that a task has been submitted */
+  std::condition_variable _all_done;       /*!< Signals that every submitted task is finished  */
+  int                     _pending;        /*!< Number of submitted tasks not finished yet     */
+  bool                    _stop;           /*!< Indicates that workers must exit               */
+};
+
+
+/*----------------------------
+ * GETTERS
+ *----------------------------*/
+
+/**
+ * \brief    Get the number of worker threads
+ * \details  --
+ * \param    void
+ * \return   \e int
+ */
+inline int ThreadPool::get_number_of_threads( void ) const
+{
+  return _number_of_threads;
+}
+
+/*----------------------------
+ * SETTERS
+ *----------------------------*/
+
+
+#endif /* defined(__SigmaFGM__ThreadPool__) */
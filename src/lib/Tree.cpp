@@ -35,17 +35,159 @@
  *----------------------------*/
 
 /**
- * \brief    Default constructor
- * \details  The tree starts with one node called the master root
- * \param    --
+ * \brief    Constructor
+ * \details  The tree starts with an empty generation, receiving the roots. Coalescence and tree sequence files are created in
+ *           the output path
+ * \param    Parameters* parameters
  * \return   \e void
  */
-Tree::Tree( void )
+Tree::Tree( Parameters* parameters )
 {
-  _node_map.clear();
-  _iterator         = _node_map.begin();
-  Node* master_root = new Node(0, 0);
-  _node_map[0]      = master_root;
+  assert(parameters != NULL);
+  
+  /*----------------------------------------------- NODES */
+  
+  _generations.clear();
+  _generations.push_back(std::vector<Node>());
+  _holes.assign(1, 0);
+  _stamps.assign(1, 0);
+  _compaction_list.clear();
+  _new_index.clear();
+  _number_of_nodes = 0;
+  _number_of_holes = 0;
+  
+  /*----------------------------------------------- SEGMENT STORE */
+  
+  _memory_budget    = (size_t)parameters->get_lineage_memory_budget()*1024*1024;
+  _first_generation = 0;
+  _segment_filename = parameters->get_output_filename("lineage_segments.bin");
+  _page.clear();
+  if (_memory_budget > 0)
+  {
+    _segment_writer.open(_segment_filename.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+  }
+  
+  /*----------------------------------------------- COALESCENCE */
+  
+  _number_of_roots  = 0;
+  _mrca.generation  = -1;
+  _mrca.index       = -1;
+  _mrca.stamp       = 0;
+  _mrca_file.open(parameters->get_output_filename("mrca.txt").c_str(), std::ios::out | std::ios::trunc);
+  _fixed_mutations_file.open(parameters->get_output_filename("fixed_mutations.txt").c_str(), std::ios::out | std::ios::trunc);
+  _mrca_file << "t mrca_t mrca_id\n";
+  _fixed_mutations_file << "id t_origin t_fixation r_mu r_sigma r_theta\n";
+  
+  /*----------------------------------------------- TREE SEQUENCE */
+  
+  _number_of_exported_nodes = 0;
+  _nodes_file.open(parameters->get_output_filename("tree_nodes.txt").c_str(), std::ios::out | std::ios::trunc);
+  _edges_file.open(parameters->get_output_filename("tree_edges.txt").c_str(), std::ios::out | std::ios::trunc);
+  _nodes_file << "is_sample\ttime\tmetadata\n";
+  _edges_file << "left\tright\tparent\tchild\n";
+}
+
+/**
+ * \brief    Constructor from backup file
+ * \details  Coalescence and tree sequence files are truncated to the length they had when the checkpoint was saved, and
+ *           reopened at their end
+ * \param    Parameters* parameters
+ * \param    std::ifstream& backup_file
+ * \return   \e void
+ */
+Tree::Tree( Parameters* parameters, std::ifstream& backup_file )
+{
+  assert(parameters != NULL);
+  
+  /*----------------------------------------------- NODES */
+  
+  int number_of_generations = 0;
+  backup_file.read((char*)&_first_generation, sizeof(_first_generation));
+  backup_file.read((char*)&number_of_generations, sizeof(number_of_generations));
+  _generations.clear();
+  _generations.resize(number_of_generations);
+  _holes.assign(number_of_generations, 0);
+  _stamps.assign(number_of_generations, 0);
+  _compaction_list.clear();
+  _new_index.clear();
+  _number_of_nodes = _first_generation;
+  _number_of_holes = 0;
+  for (int g = 0; g < number_of_generations; g++)
+  {
+    int number_of_nodes = 0;
+    backup_file.read((char*)&number_of_nodes, sizeof(number_of_nodes));
+    _generations[g].reserve(number_of_nodes);
+    for (int i = 0; i < number_of_nodes; i++)
+    {
+      _generations[g].push_back(Node(backup_file));
+      if (_generations[g].back().isReclaimed())
+      {
+        _holes[g]++;
+      }
+    }
+    _number_of_nodes += number_of_nodes-_holes[g];
+    _number_of_holes += _holes[g];
+  }
+  
+  /*----------------------------------------------- SEGMENT STORE */
+  
+  _memory_budget    = (size_t)parameters->get_lineage_memory_budget()*1024*1024;
+  _segment_filename = parameters->get_output_filename("lineage_segments.bin");
+  _page.clear();
+  if (_first_generation > 0)
+  {
+    if (truncate(_segment_filename.c_str(), (off_t)((size_t)_first_generation*Node::get_record_size())) != 0)
+    {
+      printf("Error in Tree::Tree(): segment file of the checkpointed simulation is missing. Exit.\n");
+      exit(EXIT_FAILURE);
+    }
+    _segment_writer.open(_segment_filename.c_str(), std::ios::out | std::ios::app | std::ios::binary);
+  }
+  else if (_memory_budget > 0)
+  {
+    _segment_writer.open(_segment_filename.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+  }
+  
+  /*----------------------------------------------- COALESCENCE */
+  
+  backup_file.read((char*)&_number_of_roots, sizeof(_number_of_roots));
+  backup_file.read((char*)&_mrca.generation, sizeof(_mrca.generation));
+  backup_file.read((char*)&_mrca.index, sizeof(_mrca.index));
+  _mrca.stamp = (_mrca.generation >= 0 ? _stamps[_mrca.generation-_first_generation] : 0);
+  std::string   mrca_filename            = parameters->get_output_filename("mrca.txt");
+  std::string   fixed_mutations_filename = parameters->get_output_filename("fixed_mutations.txt");
+  long long int mrca_offset              = 0;
+  long long int fixed_mutations_offset   = 0;
+  backup_file.read((char*)&mrca_offset, sizeof(mrca_offset));
+  backup_file.read((char*)&fixed_mutations_offset, sizeof(fixed_mutations_offset));
+  if (truncate(mrca_filename.c_str(), (off_t)mrca_offset) != 0 || truncate(fixed_mutations_filename.c_str(), (off_t)fixed_mutations_offset) != 0)
+  {
+    printf("Error in Tree::Tree(): coalescence files of the checkpointed simulation are missing. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  _mrca_file.open(mrca_filename.c_str(), std::ios::in | std::ios::out);
+  _fixed_mutations_file.open(fixed_mutations_filename.c_str(), std::ios::in | std::ios::out);
+  _mrca_file.seekp(0, std::ios::end);
+  _fixed_mutations_file.seekp(0, std::ios::end);
+  
+  /*----------------------------------------------- TREE SEQUENCE */
+  
+  std::string   nodes_filename = parameters->get_output_filename("tree_nodes.txt");
+  std::string   edges_filename = parameters->get_output_filename("tree_edges.txt");
+  long long int nodes_offset   = 0;
+  long long int edges_offset   = 0;
+  backup_file.read((char*)&_number_of_exported_nodes, sizeof(_number_of_exported_nodes));
+  backup_file.read((char*)&nodes_offset, sizeof(nodes_offset));
+  backup_file.read((char*)&edges_offset, sizeof(edges_offset));
+  if (truncate(nodes_filename.c_str(), (off_t)nodes_offset) != 0 || truncate(edges_filename.c_str(), (off_t)edges_offset) != 0)
+  {
+    printf("Error in Tree::Tree(): tree sequence files of the checkpointed simulation are missing. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  _nodes_file.open(nodes_filename.c_str(), std::ios::in | std::ios::out);
+  _edges_file.open(edges_filename.c_str(), std::ios::in | std::ios::out);
+  _nodes_file.seekp(0, std::ios::end);
+  _edges_file.seekp(0, std::ios::end);
 }
 
 /*----------------------------
@@ -60,13 +202,18 @@ Tree::Tree( void )
  */
 Tree::~Tree( void )
 {
-  _iterator = _node_map.begin();
-  for (_iterator = _node_map.begin(); _iterator != _node_map.end(); ++_iterator)
-  {
-    delete _iterator->second;
-    _iterator->second = NULL;
-  }
-  _node_map.clear();
+  _generations.clear();
+  _holes.clear();
+  _stamps.clear();
+  _compaction_list.clear();
+  _new_index.clear();
+  _page.clear();
+  _segment_writer.close();
+  _segment_reader.close();
+  _mrca_file.close();
+  _fixed_mutations_file.close();
+  _nodes_file.close();
+  _edges_file.close();
 }
 
 /*----------------------------
@@ -75,166 +222,113 @@ Tree::~Tree( void )
 
 /**
  * \brief    Add a root to the tree
- * \details  --
+ * \details  Roots are added before the first reproduction event
  * \param    Individual* individual
  * \return   \e void
  */
 void Tree::add_root( Individual* individual )
 {
-  /*-----------------------------*/
-  /* 1) Get the master root      */
-  /*-----------------------------*/
-  Node* master_root = _node_map[0];
-  
-  /*-----------------------------*/
-  /* 2) Create the node          */
-  /*-----------------------------*/
-  Node* node = new Node(individual);
-  
-  /*-----------------------------*/
-  /* 3) Update nodes attributes  */
-  /*-----------------------------*/
-  node->set_root();
-  node->set_parent(master_root);
-  master_root->add_child(node);
-  
-  /*-----------------------------*/
-  /* 4) Add the node to the tree */
-  /*-----------------------------*/
-  assert(_node_map.find(node->get_identifier()) == _node_map.end());
-  _node_map[node->get_identifier()] = node;
+  assert(_generations.size() == 1);
+  assert(_first_generation == 0);
+  _generations[0].push_back(Node(individual, -1));
+  _number_of_nodes++;
+  _number_of_roots++;
 }
 
 /**
- * \brief    Add a reproduction event
- * \details  --
- * \param    Individual* parent
- * \param    Individual* child
+ * \brief    Start a new generation
+ * \details  The nodes of the previous generation are now dead
+ * \param    void
  * \return   \e void
  */
-void Tree::add_reproduction_event( Individual* parent, Individual* child )
+void Tree::new_generation( void )
 {
-  /*---------------------------------*/
-  /* 1) Get parental node            */
-  /*---------------------------------*/
-  assert(_node_map.find(parent->get_identifier()) != _node_map.end());
-  Node* parent_node = _node_map[parent->get_identifier()];
-  parent_node->set_dead();
-  
-  /*---------------------------------*/
-  /* 2) Create child node            */
-  /*---------------------------------*/
-  Node* child_node = new Node(child);
-  
-  /*---------------------------------*/
-  /* 3) Update child node attributes */
-  /*---------------------------------*/
-  child_node->set_parent(parent_node);
-  parent_node->add_child(child_node);
-  
-  /*---------------------------------*/
-  /* 4) Add child node to the tree   */
-  /*---------------------------------*/
-  _node_map[child_node->get_identifier()] = child_node;
+  size_t size = _generations.back().size();
+  _generations.push_back(std::vector<Node>());
+  _generations.back().reserve(size);
+  _holes.push_back(0);
+  _stamps.push_back(0);
 }
 
 /**
- * \brief    Delete a node and remove all links
- * \details  --
- * \param    unsigned long long int node_identifier
+ * \brief    Add a reproduction event
+ * \details  The parent is given by its index in the previous generation
+ * \param    int parent
+ * \param    Individual* child
  * \return   \e void
  */
-void Tree::delete_node( unsigned long long int node_identifier )
+void Tree::add_reproduction_event( int parent, Individual* child )
 {
-  assert(_node_map.find(node_identifier) != _node_map.end());
-  Node* node = _node_map[node_identifier];
-  assert(node->get_identifier() == node_identifier);
-  assert(!node->isAlive());
-  
-  /*----------------------------------*/
-  /* 1) Update parental children list */
-  /*----------------------------------*/
-  node->get_parent()->replace_children(node);
-  
-  /*-----------------------------------*/
-  /* 2) Set the new parent of children */
-  /*-----------------------------------*/
-  for (int i = 0; i < node->get_parent()->get_number_of_children(); i++)
-  {
-    node->get_parent()->get_child(i)->set_parent(node->get_parent());
-  }
-  
-  /*----------------------------------*/
-  /* 3) Delete node                   */
-  /*----------------------------------*/
-  delete _node_map[node_identifier];
-  _node_map[node_identifier] = NULL;
-  _node_map.erase(node_identifier);
+  assert(_generations.size() > 1);
+  assert(parent >= 0);
+  assert(parent < (int)_generations[_generations.size()-2].size());
+  _generations[_generations.size()-2][parent].add_offspring((int)_generations.back().size());
+  _generations.back().push_back(Node(child, parent));
+  _number_of_nodes++;
 }
 
 /**
  * \brief    Prune the tree
- * \details  Remove all dead branches
+ * \details  Remove all dead branches. Each node counts its children in the tree: parents without offspring in the last
+ *           generation are reclaimed, and so on up their lineage until an ancestor still has children. The cost is thus
+ *           proportional to the number of deaths. Generations are compacted once half of their nodes have been reclaimed.
+ *           The most recent common ancestor of the living nodes is then updated
  * \param    void
  * \return   \e void
  */
-void Tree::prune()
+void Tree::prune( void )
 {
-  untag_tree();
+  if (_generations.size() < 2)
+  {
+    return;
+  }
   
   /*-------------------------------------*/
-  /* 1) Tag alive cells lineage          */
+  /* 1) Reclaim parents without children */
   /*-------------------------------------*/
-  for (_iterator = _node_map.begin(); _iterator != _node_map.end(); ++_iterator)
+  int                g       = get_number_of_generations()-2;
+  std::vector<Node>& parents = get_resident_generation(g);
+  for (int i = 0; i < (int)parents.size(); i++)
   {
-    assert(_iterator->first == _iterator->second->get_identifier());
-    if (_iterator->second->isAlive())
+    if (!parents[i].isReclaimed() && parents[i].get_number_of_offspring() == 0)
     {
-      _iterator->second->tag_lineage();
+      reclaim(g, i);
     }
   }
   
   /*-------------------------------------*/
-  /* 2) Build the list of untagged nodes */
+  /* 2) Compact sparse generations       */
   /*-------------------------------------*/
-  std::vector<unsigned long long int> remove_list;
-  for (_iterator = _node_map.begin(); _iterator != _node_map.end(); ++_iterator)
+  for (size_t i = 0; i < _compaction_list.size(); i++)
   {
-    if (!_iterator->second->isTagged() && !_iterator->second->isMasterRoot())
-    {
-      remove_list.push_back(_iterator->first);
-    }
+    compact(_compaction_list[i]);
   }
+  _compaction_list.clear();
   
   /*-------------------------------------*/
-  /* 3) Delete untagged nodes            */
+  /* 3) Update the common ancestor       */
   /*-------------------------------------*/
-  for (size_t i = 0; i < remove_list.size(); i++)
-  {
-    delete_node(remove_list[i]);
-  }
-  remove_list.clear();
+  update_mrca();
   
   /*-------------------------------------*/
-  /* 4) Set master root children as root */
+  /* 4) Store ancestors if over budget   */
   /*-------------------------------------*/
-  Node* master_root = _node_map[0];
-  for (int i = 0; i < master_root->get_number_of_children(); i++)
+  if (_memory_budget > 0 && get_memory_usage() > _memory_budget)
   {
-    master_root->get_child(i)->set_root();
+    spill();
   }
 }
 
 /**
  * \brief    Write best lineage statistics
- * \details  --
- * \param    void
+ * \details  The lineage of the best alive node is written from the last generation back to the roots
+ * \param    std::string filename
  * \return   \e void
  */
-void Tree::write_best_lineage_statistics( void )
+void Tree::write_best_lineage_statistics( std::string filename )
 {
-  Node* node = get_best_alive_node();
-  std::ofstream file("best_lineage.txt", std::ios::out | std::ios::trunc);
+  int node = get_best_alive_node();
+  std::ofstream file(filename.c_str(), std::ios::out | std::ios::trunc);
   file << "id" << " ";
   file << "t" << " ";
   file << "dmu" << " ";
@@ -247,57 +341,375 @@ void Tree::write_best_lineage_statistics( void )
   file << "r_mu" << " ";
   file << "r_sigma" << " ";
   file << "r_theta" << "\n";
-  while (!node->isMasterRoot())
+  for (int g = get_number_of_generations()-1; g >= 0 && node >= 0; g--)
   {
-    file << node->get_identifier() << " ";
-    file << node->get_generation() << " ";
-    file << node->get_individual()->get_dmu() << " ";
-    file << node->get_individual()->get_dz() << " ";
-    file << node->get_individual()->get_Wmu() << " ";
-    file << node->get_individual()->get_Wz() << " ";
-    file << node->get_individual()->get_max_Sigma_eigenvalue() << " ";
-    file << node->get_individual()->get_max_Sigma_contribution() << " ";
-    file << node->get_individual()->get_max_dot_product() << " ";
-    file << node->get_individual()->get_r_mu() << " ";
-    file << node->get_individual()->get_r_sigma() << " ";
-    file << node->get_individual()->get_r_theta() << "\n";
-    node = node->get_parent();
+    Node* current = get_node(g, node);
+    file << current->get_identifier() << " ";
+    file << g << " ";
+    file << current->get_dmu() << " ";
+    file << current->get_dz() << " ";
+    file << current->get_Wmu() << " ";
+    file << current->get_Wz() << " ";
+    file << current->get_EV() << " ";
+    file << current->get_EV_contribution() << " ";
+    file << current->get_EV_dot_product() << " ";
+    file << current->get_r_mu() << " ";
+    file << current->get_r_sigma() << " ";
+    file << current->get_r_theta() << "\n";
+    node = current->get_parent();
   }
   file.close();
 }
 
+/**
+ * \brief    Write the nodes not exported yet in the tree sequence
+ * \details  Called at the end of the simulation. Nodes below the MRCA are exported generation by generation, so that parents
+ *           are always exported before their children. Living nodes are the samples
+ * \param    void
+ * \return   \e void
+ */
+void Tree::write_tree_sequence( void )
+{
+  int last_generation = get_number_of_generations()-1;
+  for (int g = (_mrca.generation > 0 ? _mrca.generation : 0); g <= last_generation; g++)
+  {
+    std::vector<Node>& nodes = get_resident_generation(g);
+    for (int i = 0; i < (int)nodes.size(); i++)
+    {
+      if (!nodes[i].isReclaimed() && !nodes[i].isExported())
+      {
+        export_node(g, i, (g == last_generation));
+      }
+    }
+  }
+  _nodes_file.flush();
+  _edges_file.flush();
+}
+
+/**
+ * \brief    Save the tree in a backup file
+ * \details  Coalescence and tree sequence files are flushed first
+ * \param    std::ofstream& backup_file
+ * \return   \e void
+ */
+void Tree::save( std::ofstream& backup_file )
+{
+  int number_of_generations = (int)_generations.size();
+  backup_file.write((char*)&_first_generation, sizeof(_first_generation));
+  backup_file.write((char*)&number_of_generations, sizeof(number_of_generations));
+  for (int g = 0; g < number_of_generations; g++)
+  {
+    int number_of_nodes = (int)_generations[g].size();
+    backup_file.write((char*)&number_of_nodes, sizeof(number_of_nodes));
+    for (int i = 0; i < number_of_nodes; i++)
+    {
+      _generations[g][i].save(backup_file);
+    }
+  }
+  _segment_writer.flush();
+  _mrca_file.flush();
+  _fixed_mutations_file.flush();
+  long long int mrca_offset            = (long long int)_mrca_file.tellp();
+  long long int fixed_mutations_offset = (long long int)_fixed_mutations_file.tellp();
+  backup_file.write((char*)&_number_of_roots, sizeof(_number_of_roots));
+  backup_file.write((char*)&_mrca.generation, sizeof(_mrca.generation));
+  backup_file.write((char*)&_mrca.index, sizeof(_mrca.index));
+  backup_file.write((char*)&mrca_offset, sizeof(mrca_offset));
+  backup_file.write((char*)&fixed_mutations_offset, sizeof(fixed_mutations_offset));
+  _nodes_file.flush();
+  _edges_file.flush();
+  long long int nodes_offset = (long long int)_nodes_file.tellp();
+  long long int edges_offset = (long long int)_edges_file.tellp();
+  backup_file.write((char*)&_number_of_exported_nodes, sizeof(_number_of_exported_nodes));
+  backup_file.write((char*)&nodes_offset, sizeof(nodes_offset));
+  backup_file.write((char*)&edges_offset, sizeof(edges_offset));
+}
+
+/**
+ * \brief    List the output files a simulation resumed from a backup of the tree reopens
+ * \details  File names are relative to the output path. The segment file is only reopened if generations were stored in it
+ * \param    std::vector<std::string>& filenames
+ * \return   \e void
+ */
+void Tree::get_resumed_files( std::vector<std::string>& filenames ) const
+{
+  if (_first_generation > 0)
+  {
+    filenames.push_back("lineage_segments.bin");
+  }
+  filenames.push_back("mrca.txt");
+  filenames.push_back("fixed_mutations.txt");
+  filenames.push_back("tree_nodes.txt");
+  filenames.push_back("tree_edges.txt");
+}
+
 /*----------------------------
  * PROTECTED METHODS
  *----------------------------*/
 
 /**
- * \brief    Tag all the offspring of this node
+ * \brief    Reclaim a node without children, and its ancestors left without children
  * \details  --
- * \param    Node* node
- * \param    std::vector<Node*>* tagged_nodes
+ * \param    int generation
+ * \param    int index
+ * \return   \e void
+ */
+void Tree::reclaim( int generation, int index )
+{
+  int g = generation;
+  int i = index;
+  while (true)
+  {
+    Node* node  = &get_resident_generation(g)[i];
+    int&  holes = _holes[g-_first_generation];
+    node->reclaim();
+    _number_of_nodes--;
+    _number_of_holes++;
+    holes++;
+    if (holes*2 > get_number_of_nodes(g) && (holes-1)*2 <= get_number_of_nodes(g))
+    {
+      _compaction_list.push_back(g);
+    }
+    if (node->isRoot())
+    {
+      _number_of_roots--;
+      return;
+    }
+    Node* parent = &get_resident_generation(g-1)[node->get_parent()];
+    parent->remove_offspring();
+    if (parent->get_number_of_offspring() > 0)
+    {
+      return;
+    }
+    i = node->get_parent();
+    g--;
+  }
+}
+
+/**
+ * \brief    Remove the reclaimed nodes of a generation
+ * \details  The parental indices of the next generation and the children ranges of the previous generation are updated.
+ *           Handles on the generation are invalidated
+ * \param    int generation
  * \return   \e void
  */
-void Tree::tag_offspring( Node* node, std::vector<Node*>* tagged_nodes )
+void Tree::compact( int generation )
 {
-  untag_tree();
-  tagged_nodes->clear();
-  tagged_nodes->push_back(node);
-  bool end = false;
-  while (!end)
+  std::vector<Node>& nodes = get_resident_generation(generation);
+  
+  /*----------------------------------------*/
+  /* 1) Move remaining nodes                */
+  /*----------------------------------------*/
+  /* A reclaimed node gets the new index of the next remaining node, so that children ranges remain valid */
+  _new_index.assign(nodes.size()+1, 0);
+  int size = 0;
+  for (size_t i = 0; i < nodes.size(); i++)
+  {
+    _new_index[i] = size;
+    if (!nodes[i].isReclaimed())
+    {
+      if ((int)i != size)
+      {
+        nodes[size] = nodes[i];
+      }
+      size++;
+    }
+  }
+  _new_index[nodes.size()] = size;
+  nodes.erase(nodes.begin()+size, nodes.end());
+  nodes.shrink_to_fit();
+  _number_of_holes                     -= _holes[generation-_first_generation];
+  _holes[generation-_first_generation]  = 0;
+  _stamps[generation-_first_generation]++;
+  if (_mrca.generation == generation)
+  {
+    _mrca = get_handle(generation, _new_index[_mrca.index]);
+  }
+  
+  /*----------------------------------------*/
+  /* 2) Update children parental indices    */
+  /*----------------------------------------*/
+  if (generation+1 < get_number_of_generations())
+  {
+    std::vector<Node>& children = get_resident_generation(generation+1);
+    for (size_t i = 0; i < children.size(); i++)
+    {
+      if (!children[i].isReclaimed())
+      {
+        children[i].set_parent(_new_index[children[i].get_parent()]);
+      }
+    }
+  }
+  
+  /*----------------------------------------*/
+  /* 3) Update parental children ranges     */
+  /*----------------------------------------*/
+  if (generation > _first_generation)
   {
-    end = true;
-    for (int i = 0; i < (int)tagged_nodes->size(); i++)
+    std::vector<Node>& parents = get_resident_generation(generation-1);
+    for (size_t i = 0; i < parents.size(); i++)
     {
-      for (int j = 0; j < tagged_nodes->at(i)->get_number_of_children(); j++)
+      if (!parents[i].isReclaimed())
       {
-        if (!tagged_nodes->at(i)->get_child(j)->isTagged())
-        {
-          end = false;
-          tagged_nodes->at(i)->get_child(j)->tag();
-          tagged_nodes->push_back(tagged_nodes->at(i)->get_child(j));
-        }
+        parents[i].set_children(_new_index[parents[i].get_first_child()], _new_index[parents[i].get_last_child()]);
       }
     }
   }
 }
 
+/**
+ * \brief    Update the most recent common ancestor of the living nodes
+ * \details  Once the roots coalesced, the MRCA only moves forward in time, down the single child of the current MRCA, until
+ *           it has several children. Its cost is thus amortized O(1) per generation. Each node passed by the MRCA is an
+ *           ancestor of the whole population: its mutation is recorded as fixed, and the node, which will not change anymore,
+ *           is exported in the tree sequence
+ * \param    void
+ * \return   \e void
+ */
+void Tree::update_mrca( void )
+{
+  int  last_generation = get_number_of_generations()-1;
+  bool changed         = false;
+  
+  /*----------------------------------------*/
+  /* 1) Wait for the roots to coalesce      */
+  /*----------------------------------------*/
+  if (_mrca.generation == -1)
+  {
+    if (_number_of_roots > 1)
+    {
+      return;
+    }
+    std::vector<Node>& roots = get_resident_generation(0);
+    for (int i = 0; i < (int)roots.size(); i++)
+    {
+      if (!roots[i].isReclaimed())
+      {
+        _mrca   = get_handle(0, i);
+        changed = true;
+        export_node(0, i, false);
+        break;
+      }
+    }
+    assert(_mrca.generation == 0);
+  }
+  
+  /*----------------------------------------*/
+  /* 2) Move the MRCA down unary lineages   */
+  /*----------------------------------------*/
+  Node* mrca = get_node(_mrca);
+  while (_mrca.generation < last_generation && mrca->get_number_of_offspring() == 1)
+  {
+    int child = mrca->get_first_child();
+    while (get_resident_generation(_mrca.generation+1)[child].isReclaimed())
+    {
+      child++;
+    }
+    assert(child < mrca->get_last_child());
+    _mrca   = get_handle(_mrca.generation+1, child);
+    mrca    = get_node(_mrca);
+    changed = true;
+    export_node(_mrca.generation, _mrca.index, (_mrca.generation == last_generation));
+    if (mrca->hasMutation())
+    {
+      _fixed_mutations_file << mrca->get_identifier() << " " << _mrca.generation << " " << last_generation << " " << mrca->get_r_mu() << " " << mrca->get_r_sigma() << " " << mrca->get_r_theta() << "\n";
+    }
+  }
+  
+  /*----------------------------------------*/
+  /* 3) Write the new MRCA                  */
+  /*----------------------------------------*/
+  if (changed)
+  {
+    _mrca_file << last_generation << " " << _mrca.generation << " " << mrca->get_identifier() << "\n";
+  }
+}
+
+/**
+ * \brief    Export a node in the tree sequence
+ * \details  Node and edge tables follow the tskit text format: node times are negative generations (parents are older than
+ *           their children), the metadata is the identifier of the individual, and edges span the unit interval
+ * \param    int generation
+ * \param    int index
+ * \param    bool sample
+ * \return   \e void
+ */
+void Tree::export_node( int generation, int index, bool sample )
+{
+  Node* node = &get_resident_generation(generation)[index];
+  assert(!node->isExported());
+  node->set_export_identifier(_number_of_exported_nodes++);
+  _nodes_file << (sample ? 1 : 0) << "\t" << -generation << "\t" << node->get_identifier() << "\n";
+  if (!node->isRoot())
+  {
+    Node* parent = get_node(generation-1, node->get_parent());
+    assert(parent->isExported());
+    _edges_file << 0 << "\t" << 1 << "\t" << parent->get_export_identifier() << "\t" << node->get_export_identifier() << "\n";
+  }
+}
+
+/**
+ * \brief    Move the ancestors of the MRCA to the segment file
+ * \details  Generations older than the MRCA only hold the ancestral lineage of the whole population, and will never change
+ *           anymore: their single node is appended to the segment file, and their memory is released
+ * \param    void
+ * \return   \e void
+ */
+void Tree::spill( void )
+{
+  if (_first_generation >= _mrca.generation)
+  {
+    return;
+  }
+  assert(_segment_writer.is_open());
+  while (_first_generation < _mrca.generation)
+  {
+    std::vector<Node>& nodes = _generations.front();
+    assert((int)nodes.size()-_holes.front() == 1);
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+      if (!nodes[i].isReclaimed())
+      {
+        nodes[i].save(_segment_writer);
+        break;
+      }
+    }
+    _number_of_holes -= _holes.front();
+    _generations.pop_front();
+    _holes.pop_front();
+    _stamps.pop_front();
+    _first_generation++;
+  }
+  if (!_segment_writer)
+  {
+    printf("Error in Tree::spill(): impossible to write segment file %s. Exit.\n", _segment_filename.c_str());
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * \brief    Page back the ancestral node of a generation stored in the segment file
+ * \details  --
+ * \param    int generation
+ * \return   \e Node*
+ */
+Node* Tree::page_in( int generation )
+{
+  assert(generation >= 0);
+  assert(generation < _first_generation);
+  _segment_writer.flush();
+  if (!_segment_reader.is_open())
+  {
+    _segment_reader.open(_segment_filename.c_str(), std::ios::in | std::ios::binary);
+  }
+  _segment_reader.clear();
+  _segment_reader.seekg((std::streamoff)((size_t)generation*Node::get_record_size()));
+  _page.clear();
+  _page.push_back(Node(_segment_reader));
+  if (!_segment_reader)
+  {
+    printf("Error in Tree::page_in(): impossible to read segment file %s. Exit.\n", _segment_filename.c_str());
+    exit(EXIT_FAILURE);
+  }
+  return &_page[0];
+}
@@ -32,14 +32,18 @@
 
 #include <iostream>
 #include <vector>
-#include <unordered_map>
+#include <deque>
 #include <cstring>
 #include <cmath>
 #include <fstream>
 #include <sstream>
+#include <unistd.h>
+#include <assert.h>
 
 #include "Macros.h"
 #include "Enums.h"
+#include "Structs.h"
+#include "Parameters.h"
 #include "Individual.h"
 #include "Node.h"
 
@@ -52,7 +56,9 @@ public:
   /*----------------------------
    * CONSTRUCTORS
    *----------------------------*/
-  Tree( void );
+  Tree( void ) = delete;
+  Tree( Parameters* parameters );
+  Tree( Parameters* parameters, std::ifstream& backup_file );
   Tree( const Tree& tree ) = delete;
   
   /*----------------------------
@@ -63,11 +69,17 @@ public:
   /*----------------------------
    * GETTERS
    *----------------------------*/
-  inline int    get_number_of_nodes( void ) const;
-  inline Node*  get_node( unsigned long long int identifier );
-  inline Node*  get_first_node( void );
-  inline Node*  get_next_node( void );
-  inline Node*  get_best_alive_node( void );
+  inline int         get_number_of_nodes( void ) const;
+  inline int         get_number_of_generations( void ) const;
+  inline int         get_number_of_nodes( int generation ) const;
+  inline Node*       get_node( int generation, int index );
+  inline Node*       get_node( node_handle handle );
+  inline node_handle get_handle( int generation, int index ) const;
+  inline bool        is_valid( node_handle handle ) const;
+  inline int         get_best_alive_node( void ) const;
+  inline int         get_mrca_generation( void ) const;
+  inline int         get_first_resident_generation( void ) const;
+  inline size_t      get_memory_usage( void ) const;
   
   /*----------------------------
    * SETTERS
@@ -78,10 +90,13 @@ public:
    * PUBLIC METHODS
    *----------------------------*/
   void add_root( Individual* individual );
-  void add_reproduction_event( Individual* parent, Individual* child );
-  void delete_node( unsigned long long int node_identifier );
-  void prune();
-  void write_best_lineage_statistics( void );
+  void new_generation( void );
+  void add_reproduction_event( int parent, Individual* child );
+  void prune( void );
+  void write_best_lineage_statistics( std::string filename );
+  void write_tree_sequence( void );
+  void save( std::ofstream& backup_file );
+  void get_resumed_files( std::vector<std::string>& filenames ) const;
   
   /*----------------------------
    * PUBLIC ATTRIBUTES
@@ -92,15 +107,49 @@ protected:
   /*----------------------------
    * PROTECTED METHODS
    *----------------------------*/
-  inline void tag_tree();
-  inline void untag_tree();
-  void        tag_offspring( Node* node, std::vector<Node*>* tagged_nodes );
+  inline std::vector<Node>& get_resident_generation( int generation );
+  void                      reclaim( int generation, int index );
+  void                      compact( int generation );
+  void                      update_mrca( void );
+  void                      export_node( int generation, int index, bool sample );
+  void                      spill( void );
+  Node*                     page_in( int generation );
   
   /*----------------------------
    * PROTECTED ATTRIBUTES
    *----------------------------*/
-  std::unordered_map<unsigned long long int, Node*>           _node_map; /*!< Tree nodes map    */
-  std::unordered_map<unsigned long long int, Node*>::iterator _iterator; /*!< Tree map iterator */
+  
+  /*----------------------------------------------- NODES */
+  
+  std::deque< std::vector<Node> > _generations;     /*!< Nodes of each resident generation (the last one is alive) */
+  std::deque<int>                 _holes;           /*!< Number of reclaimed nodes in each resident generation     */
+  std::deque<unsigned int>        _stamps;          /*!< Number of compactions of each resident generation         */
+  std::vector<int>                _compaction_list; /*!< Generations to compact at the end of the pruning          */
+  std::vector<int>                _new_index;       /*!< New index of each node during compaction                  */
+  int                             _number_of_nodes; /*!< Total number of nodes (reclaimed nodes excluded)          */
+  int                             _number_of_holes; /*!< Total number of reclaimed nodes not compacted yet         */
+  
+  /*----------------------------------------------- SEGMENT STORE */
+  
+  size_t            _memory_budget;    /*!< Memory budget of the resident generations in bytes (0 if unlimited)   */
+  int               _first_generation; /*!< First resident generation (older ones are stored in the segment file) */
+  std::string       _segment_filename; /*!< Segment file name                                                     */
+  std::ofstream     _segment_writer;   /*!< Append-only segment file, one ancestral node per stored generation   */
+  std::ifstream     _segment_reader;   /*!< Segment file, opened for reading on the first paging                 */
+  std::vector<Node> _page;             /*!< Last node paged back from the segment file                           */
+  
+  /*----------------------------------------------- COALESCENCE */
+  
+  int           _number_of_roots;      /*!< Number of roots having living descendants                               */
+  node_handle   _mrca;                 /*!< Most recent common ancestor of the living nodes (generation -1 if none) */
+  std::ofstream _mrca_file;            /*!< MRCA changes file                                                       */
+  std::ofstream _fixed_mutations_file; /*!< Fixed mutations file                                                    */
+  
+  /*----------------------------------------------- TREE SEQUENCE */
+  
+  int           _number_of_exported_nodes; /*!< Number of rows of the exported node table */
+  std::ofstream _nodes_file;               /*!< Exported node table                       */
+  std::ofstream _edges_file;               /*!< Exported edge table                       */
 };
 
 
@@ -116,114 +165,181 @@ protected:
  */
 inline int Tree::get_number_of_nodes( void ) const
 {
-  return (int)_node_map.size();
+  return _number_of_nodes;
 }
 
 /**
- * \brief    Get the node by its identifier
- * \details  Return NULL if the node do not exist
- * \param    unsigned long long int identifier
- * \return   \e Node*
+ * \brief    Get the number of generations of the tree
+ * \details  --
+ * \param    void
+ * \return   \e int
  */
-inline Node* Tree::get_node( unsigned long long int identifier )
+inline int Tree::get_number_of_generations( void ) const
 {
-  if (_node_map.find(identifier) != _node_map.end())
+  return _first_generation+(int)_generations.size();
+}
+
+/**
+ * \brief    Get the number of nodes of a generation
+ * \details  Reclaimed nodes not compacted yet are included. Generations stored in the segment file only hold their ancestral
+ *           node
+ * \param    int generation
+ * \return   \e int
+ */
+inline int Tree::get_number_of_nodes( int generation ) const
+{
+  assert(generation >= 0);
+  assert(generation < get_number_of_generations());
+  if (generation < _first_generation)
   {
-    return _node_map[identifier];
+    return 1;
   }
-  return NULL;
+  return (int)_generations[generation-_first_generation].size();
 }
 
 /**
- * \brief    Get the first node of the map
- * \details  Return NULL if the tree is empty
- * \param    void
+ * \brief    Get a node by its generation and its index in the generation
+ * \details  Nodes of the generations stored in the segment file are paged back on demand: the returned node is then only
+ *           valid until the next paging, and must not be modified
+ * \param    int generation
+ * \param    int index
  * \return   \e Node*
  */
-inline Node* Tree::get_first_node( void )
+inline Node* Tree::get_node( int generation, int index )
 {
-  _iterator = _node_map.begin();
-  if (_iterator != _node_map.end())
+  assert(generation >= 0);
+  assert(generation < get_number_of_generations());
+  assert(index >= 0);
+  if (generation < _first_generation)
   {
-    return _iterator->second;
+    return page_in(generation);
   }
-  return NULL;
+  assert(index < (int)_generations[generation-_first_generation].size());
+  return &_generations[generation-_first_generation][index];
 }
 
 /**
- * \brief    Get the next node
- * \details  Return NULL if the end of the tree is reached
- * \param    void
+ * \brief    Get a node by its handle
+ * \details  The handle must be valid
+ * \param    node_handle handle
  * \return   \e Node*
  */
-inline Node* Tree::get_next_node( void )
+inline Node* Tree::get_node( node_handle handle )
+{
+  assert(is_valid(handle));
+  return get_node(handle.generation, handle.index);
+}
+
+/**
+ * \brief    Get the handle of a node
+ * \details  The handle remains valid until the generation of the node is compacted
+ * \param    int generation
+ * \param    int index
+ * \return   \e node_handle
+ */
+inline node_handle Tree::get_handle( int generation, int index ) const
 {
-  _iterator++;
-  if (_iterator != _node_map.end())
+  assert(generation >= 0);
+  assert(generation < get_number_of_generations());
+  assert(index >= 0);
+  assert(index < get_number_of_nodes(generation));
+  node_handle handle;
+  handle.generation = generation;
+  handle.index      = index;
+  handle.stamp      = (generation < _first_generation ? 0 : _stamps[generation-_first_generation]);
+  return handle;
+}
+
+/**
+ * \brief    Check if a node handle is still valid
+ * \details  Generations stored in the segment file never change: handles on them remain valid
+ * \param    node_handle handle
+ * \return   \e bool
+ */
+inline bool Tree::is_valid( node_handle handle ) const
+{
+  if (handle.generation < 0 || handle.generation >= get_number_of_generations())
   {
-    return _iterator->second;
+    return false;
   }
-  return NULL;
+  return (handle.generation < _first_generation || handle.stamp == _stamps[handle.generation-_first_generation]);
 }
 
 /**
  * \brief    Get best alive node
- * \details  --
+ * \details  Returns the index of the best node of the last generation (-1 if the generation is empty)
  * \param    void
- * \return   \e Node*
+ * \return   \e int
  */
-inline Node* Tree::get_best_alive_node( void )
+inline int Tree::get_best_alive_node( void ) const
 {
-  double best_w    = 0.0;
-  Node*  best_node = NULL;
-  for (_iterator = _node_map.begin(); _iterator != _node_map.end(); ++_iterator)
+  const std::vector<Node>& alive     = _generations.back();
+  double                   best_w    = 0.0;
+  int                      best_node = -1;
+  for (size_t i = 0; i < alive.size(); i++)
   {
-    if (_iterator->second->isAlive())
+    if (best_w < alive[i].get_Wz())
     {
-      if (best_w < _iterator->second->get_individual()->get_Wz())
-      {
-        best_w    = _iterator->second->get_individual()->get_Wz();
-        best_node = _iterator->second;
-      }
+      best_w    = alive[i].get_Wz();
+      best_node = (int)i;
     }
   }
   return best_node;
 }
 
-/*----------------------------
- * SETTERS
- *----------------------------*/
+/**
+ * \brief    Get the generation of the most recent common ancestor of the living nodes
+ * \details  Returns -1 if the lineages of the initial population did not coalesce yet
+ * \param    void
+ * \return   \e int
+ */
+inline int Tree::get_mrca_generation( void ) const
+{
+  return _mrca.generation;
+}
 
-/*----------------------------
- * PROTECTED METHODS
- *----------------------------*/
+/**
+ * \brief    Get the first generation kept in memory
+ * \details  Older generations are stored in the segment file
+ * \param    void
+ * \return   \e int
+ */
+inline int Tree::get_first_resident_generation( void ) const
+{
+  return _first_generation;
+}
 
 /**
- * \brief    Tag all the nodes
- * \details  --
+ * \brief    Get the approximate memory used by the resident generations
+ * \details  In bytes. Reclaimed nodes not compacted yet are included
  * \param    void
- * \return   \e void
+ * \return   \e size_t
  */
-inline void Tree::tag_tree()
+inline size_t Tree::get_memory_usage( void ) const
 {
-  for (_iterator = _node_map.begin(); _iterator != _node_map.end(); ++_iterator)
-  {
-    _iterator->second->tag();
-  }
+  size_t resident_nodes = (size_t)(_number_of_nodes-_first_generation+_number_of_holes);
+  return resident_nodes*sizeof(Node)+_generations.size()*(sizeof(std::vector<Node>)+sizeof(int)+sizeof(unsigned int));
 }
 
+/*----------------------------
+ * SETTERS
+ *----------------------------*/
+
+/*----------------------------
+ * PROTECTED METHODS
+ *----------------------------*/
+
 /**
- * \brief    Untag all the nodes
+ * \brief    Get the nodes of a resident generation
  * \details  --
- * \param    void
- * \return   \e void
+ * \param    int generation
+ * \return   \e std::vector<Node>&
  */
-inline void Tree::untag_tree()
+inline std::vector<Node>& Tree::get_resident_generation( int generation )
 {
-  for (_iterator = _node_map.begin(); _iterator != _node_map.end(); ++_iterator)
-  {
-    _iterator->second->untag();
-  }
+  assert(generation >= _first_generation);
+  assert(generation < get_number_of_generations());
+  return _generations[generation-_first_generation];
 }
 
 
@@ -0,0 +1,69 @@
+
+/**
+ * \file      TestParameters.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Default simulation parameters of the tests and benchmarks
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "TestParameters.h"
+
+
+/**
+ * \brief    Create the default parameters of a test or benchmark simulation
+ * \details  The population starts at distance 1 from the optimum (initial sigma 0.1, theta 0), without stabilization, with
+ *           mutation rates 0.1 and mutation sizes 0.05 (alpha 0.5, beta 0, Q 2), and without file output. Callers adjust
+ *           the other parameters (mean fitness, engine, ...) on the returned object, which they own
+ * \param    unsigned long int seed
+ * \param    int generations
+ * \param    int number_of_dimensions
+ * \param    int population_size
+ * \param    type_of_noise noise_type
+ * \return   \e Parameters*
+ */
+Parameters* createTestParameters( unsigned long int seed, int generations, int number_of_dimensions, int population_size, type_of_noise noise_type )
+{
+  Parameters* parameters = new Parameters();
+  parameters->set_seed(seed);
+  parameters->set_number_of_stabilizing_generations(0);
+  parameters->set_number_of_generations(generations);
+  parameters->set_number_of_dimensions(number_of_dimensions);
+  parameters->set_alpha(0.5);
+  parameters->set_beta(0.0);
+  parameters->set_Q(2.0);
+  parameters->set_population_size(population_size);
+  parameters->set_initial_mu(1.0);
+  parameters->set_initial_sigma(0.1);
+  parameters->set_initial_theta(0.0);
+  parameters->set_mean_fitness(false);
+  parameters->set_m_mu(0.1);
+  parameters->set_m_sigma(0.1);
+  parameters->set_m_theta(0.1);
+  parameters->set_s_mu(0.05);
+  parameters->set_s_sigma(0.05);
+  parameters->set_s_theta(0.05);
+  parameters->set_noise_type(noise_type);
+  parameters->set_file_output(false);
+  return parameters;
+}
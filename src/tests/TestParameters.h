@@ -0,0 +1,43 @@
+
+/**
+ * \file      TestParameters.h
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Default simulation parameters of the tests and benchmarks
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#ifndef __SigmaFGM__TestParameters__
+#define __SigmaFGM__TestParameters__
+
+#include <iostream>
+#include <assert.h>
+
+#include "../lib/Macros.h"
+#include "../lib/Enums.h"
+#include "../lib/Parameters.h"
+
+Parameters* createTestParameters( unsigned long int seed, int generations, int number_of_dimensions, int population_size, type_of_noise noise_type );
+
+
+#endif /* defined(__SigmaFGM__TestParameters__) */
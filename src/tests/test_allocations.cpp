@@ -0,0 +1,214 @@
+
+/**
+ * \file      test_allocations.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Heap allocation budget of a steady-state generation
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "../../cmake/Config.h"
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <assert.h>
+
+#include "../lib/Macros.h"
+#include "../lib/Enums.h"
+#include "../lib/Parameters.h"
+#include "../lib/Simulation.h"
+#include "TestParameters.h"
+#include "../lib/AllocationCounter.h"
+
+/**
+ * \brief   Exit status of a skipped test (see SKIP_RETURN_CODE in CMakeLists.txt)
+ * \details --
+ */
+const int TEST_SKIPPED = 77;
+
+void readArgs( int argc, char const** argv, unsigned long int& seed, int& population_size, int& dimensions, int& warmup, int& generations, double& budget );
+void printUsage( void );
+
+
+/**
+ * \brief    Main function
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int main( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read parameters                 */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  unsigned long int seed            = 1;
+  int               population_size = 200;
+  int               dimensions      = 5;
+  int               warmup          = 5;
+  int               generations     = 20;
+  double            budget          = -1.0;
+  readArgs(argc, argv, seed, population_size, dimensions, warmup, generations, budget);
+  if (!AllocationCounter::is_enabled())
+  {
+    std::cout << "Heap allocations are not counted on this platform, test skipped.\n";
+    return TEST_SKIPPED;
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Create the simulation           */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  Parameters* parameters = createTestParameters(seed, warmup+generations, dimensions, population_size, FULL);
+  Simulation* simulation = new Simulation(parameters);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Warm up                         */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  simulation->run(warmup);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Measure each generation         */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  unsigned long long int max_allocations = 0;
+  std::cout << "generation allocations bytes\n";
+  for (int g = warmup+1; g <= warmup+generations; g++)
+  {
+    unsigned long long int allocations = AllocationCounter::get_allocations();
+    unsigned long long int bytes       = AllocationCounter::get_allocated_bytes();
+    simulation->run(g);
+    allocations = AllocationCounter::get_allocations()-allocations;
+    bytes       = AllocationCounter::get_allocated_bytes()-bytes;
+    std::cout << g << " " << allocations << " " << bytes << "\n";
+    max_allocations = (allocations > max_allocations ? allocations : max_allocations);
+  }
+  delete simulation;
+  simulation = NULL;
+  delete parameters;
+  parameters = NULL;
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 5) Check the budget                */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  if (budget >= 0.0 && (double)max_allocations > budget)
+  {
+    printf("Error: a steady-state generation performs %llu heap allocations, over the budget of %.0f.\n", max_allocations, budget);
+    return EXIT_FAILURE;
+  }
+  std::cout << "At most " << max_allocations << " heap allocations per steady-state generation.\n";
+  return EXIT_SUCCESS;
+}
+
+/**
+ * \brief    Read command line arguments
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \param    unsigned long int& seed
+ * \param    int& population_size
+ * \param    int& dimensions
+ * \param    int& warmup
+ * \param    int& generations
+ * \param    double& budget
+ * \return   \e void
+ */
+void readArgs( int argc, char const** argv, unsigned long int& seed, int& population_size, int& dimensions, int& warmup, int& generations, double& budget )
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+    {
+      printUsage();
+      exit(EXIT_SUCCESS);
+    }
+    else if (i+1 == argc)
+    {
+      std::cout << "Error: command line parameter value is missing.\n";
+      exit(EXIT_FAILURE);
+    }
+    else if (strcmp(argv[i], "-seed") == 0 || strcmp(argv[i], "--seed") == 0)
+    {
+      seed = (unsigned long int)atol(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-popsize") == 0 || strcmp(argv[i], "--population-size") == 0)
+    {
+      population_size = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-nbdim") == 0 || strcmp(argv[i], "--number-of-dimensions") == 0)
+    {
+      dimensions = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-warmup") == 0 || strcmp(argv[i], "--warmup") == 0)
+    {
+      warmup = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-g") == 0 || strcmp(argv[i], "--generations") == 0)
+    {
+      generations = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-budget") == 0 || strcmp(argv[i], "--budget") == 0)
+    {
+      budget = atof(argv[++i]);
+    }
+    else
+    {
+      printf("Error: unknown option %s (see -h or --help). Exit.\n", argv[i]);
+      exit(EXIT_FAILURE);
+    }
+  }
+  if (seed == 0 || population_size <= 0 || dimensions <= 0 || warmup <= 0 || generations <= 0)
+  {
+    printf("Error: the seed, the population size, the number of dimensions and the numbers of generations must be positive. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * \brief    Print usage
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printUsage( void )
+{
+  std::cout << "Usage: test_allocations -h or --help\n";
+  std::cout << "   or: test_allocations [options]\n";
+  std::cout << "Counts the heap allocations (GSL vectors and matrices, and operator new) of each steady-state generation,\n";
+  std::cout << "and fails if one of them exceeds the budget\n";
+  std::cout << "Options are:\n";
+  std::cout << "  -h, --help\n";
+  std::cout << "        print this help, then exit\n";
+  std::cout << "  -seed, --seed\n";
+  std::cout << "        specify the prng seed (1 by default)\n";
+  std::cout << "  -popsize, --population-size\n";
+  std::cout << "        specify the population size (200 by default)\n";
+  std::cout << "  -nbdim, --number-of-dimensions\n";
+  std::cout << "        specify the number of phenotypic dimensions (5 by default)\n";
+  std::cout << "  -warmup, --warmup\n";
+  std::cout << "        specify the number of generations before the measure (5 by default)\n";
+  std::cout << "  -g, --generations\n";
+  std::cout << "        specify the number of measured generations (20 by default)\n";
+  std::cout << "  -budget, --budget\n";
+  std::cout << "        specify the maximum number of heap allocations per generation (no budget by default)\n";
+}
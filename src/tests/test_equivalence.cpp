@@ -0,0 +1,511 @@
+
+/**
+ * \file      test_equivalence.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Statistical equivalence of a candidate engine with the reference engine
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "../../cmake/Config.h"
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <assert.h>
+
+#include "../lib/Macros.h"
+#include "../lib/Enums.h"
+#include "../lib/Parameters.h"
+#include "../lib/Simulation.h"
+#include "TestParameters.h"
+
+/**
+ * \brief   Trajectories of a sample of replicates
+ * \details Per-generation statistics are indexed by [generation-1][replicate]
+ */
+typedef struct
+{
+  std::vector< std::vector<double> > dmu;             /*!< Mean distance to the optimum (mu) per generation */
+  std::vector< std::vector<double> > Wz;              /*!< Mean fitness (z) per generation                  */
+  std::vector<double>                time_to_shutoff; /*!< Generation reaching the shutoff distance         */
+} engine_sample;
+
+/**
+ * \brief   Test settings
+ * \details --
+ */
+typedef struct
+{
+  std::string   reference;            /*!< Reference engine                                */
+  std::string   candidate;            /*!< Candidate engine                                */
+  int           replicates;           /*!< Number of replicates (seeds) per engine         */
+  int           generations;          /*!< Number of generations per replicate             */
+  int           population_size;      /*!< Population size                                 */
+  int           number_of_dimensions; /*!< Number of phenotypic dimensions                 */
+  type_of_noise noise_type;           /*!< Type of phenotypic noise                        */
+  double        shutoff_distance;     /*!< Shutoff distance                                */
+  double        significance;         /*!< Family-wise significance level                  */
+  std::string   output;               /*!< Report file of every test (none if empty)       */
+} test_settings;
+
+void          readArgs( int argc, char const** argv, test_settings& settings );
+void          printUsage( void );
+void          checkEngine( const std::string& engine );
+engine_sample runEngine( const test_settings& settings, const std::string& engine, unsigned long int first_seed );
+double        ksTest( std::vector<double> x, std::vector<double> y, double& D );
+double        meanTest( const std::vector<double>& x, const std::vector<double>& y );
+double        varianceTest( const std::vector<double>& x, const std::vector<double>& y );
+
+
+/**
+ * \brief    Main function
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int main( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read parameters                 */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  test_settings settings;
+  settings.reference            = "REFERENCE";
+  settings.candidate            = "REFERENCE";
+  settings.replicates           = 50;
+  settings.generations          = 100;
+  settings.population_size      = 100;
+  settings.number_of_dimensions = 3;
+  settings.noise_type           = FULL;
+  settings.shutoff_distance     = 1.5;
+  settings.significance         = 0.001;
+  settings.output               = "";
+  readArgs(argc, argv, settings);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Run both engines                */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  
+  /* Seeds are disjoint, so that an engine compared with itself gives independent samples */
+  engine_sample reference = runEngine(settings, settings.reference, 1);
+  engine_sample candidate = runEngine(settings, settings.candidate, 1+settings.replicates);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Compare the distributions       */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  
+  /*** Bonferroni correction over every test (3 tests per metric and generation, and 3 for the time to shutoff) ***/
+  int           number_of_tests = 3*(2*settings.generations+1);
+  double        threshold       = settings.significance/number_of_tests;
+  int           failures        = 0;
+  double        min_p_value     = 1.0;
+  std::string   min_p_test      = "";
+  std::ofstream report;
+  if (settings.output != "")
+  {
+    report.open(settings.output.c_str(), std::ios::out | std::ios::trunc);
+    if (!report)
+    {
+      printf("Error: impossible to open file %s. Exit.\n", settings.output.c_str());
+      exit(EXIT_FAILURE);
+    }
+    report << "metric generation KS_D KS_p mean_p variance_p\n";
+  }
+  for (int metric = 0; metric < 3; metric++)
+  {
+    int generations = (metric < 2 ? settings.generations : 1);
+    for (int g = 1; g <= generations; g++)
+    {
+      const char*                name = (metric == 0 ? "dmu" : (metric == 1 ? "Wz" : "time_to_shutoff"));
+      const std::vector<double>& x    = (metric == 0 ? reference.dmu[g-1] : (metric == 1 ? reference.Wz[g-1] : reference.time_to_shutoff));
+      const std::vector<double>& y    = (metric == 0 ? candidate.dmu[g-1] : (metric == 1 ? candidate.Wz[g-1] : candidate.time_to_shutoff));
+      double D          = 0.0;
+      double p_values[] = {ksTest(x, y, D), meanTest(x, y), varianceTest(x, y)};
+      const char* test_names[] = {"KS", "mean", "variance"};
+      for (int test = 0; test < 3; test++)
+      {
+        std::string test_name = std::string(name)+(metric < 2 ? " (generation "+std::to_string(g)+")" : "")+" "+test_names[test];
+        if (p_values[test] < min_p_value)
+        {
+          min_p_value = p_values[test];
+          min_p_test  = test_name;
+        }
+        if (p_values[test] < threshold)
+        {
+          printf("Divergence: %s test, p-value = %g\n", test_name.c_str(), p_values[test]);
+          failures++;
+        }
+      }
+      if (report.is_open())
+      {
+        report << name << " " << (metric < 2 ? g : 0) << " " << D << " " << p_values[0] << " " << p_values[1] << " " << p_values[2] << "\n";
+      }
+    }
+  }
+  if (report.is_open())
+  {
+    report.close();
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Conclude                        */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::cout << settings.candidate << " vs " << settings.reference << ": " << number_of_tests << " tests on " << settings.replicates << " replicates each, ";
+  std::cout << "smallest p-value " << min_p_value << " (" << min_p_test << "), corrected threshold " << threshold << "\n";
+  if (failures > 0)
+  {
+    printf("Error: %d tests show a significant divergence of engine %s from engine %s.\n", failures, settings.candidate.c_str(), settings.reference.c_str());
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+/**
+ * \brief    Read command line arguments
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \param    test_settings& settings
+ * \return   \e void
+ */
+void readArgs( int argc, char const** argv, test_settings& settings )
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+    {
+      printUsage();
+      exit(EXIT_SUCCESS);
+    }
+    else if (i+1 == argc)
+    {
+      std::cout << "Error: command line parameter value is missing.\n";
+      exit(EXIT_FAILURE);
+    }
+    else if (strcmp(argv[i], "-reference") == 0 || strcmp(argv[i], "--reference") == 0)
+    {
+      settings.reference = argv[++i];
+    }
+    else if (strcmp(argv[i], "-candidate") == 0 || strcmp(argv[i], "--candidate") == 0)
+    {
+      settings.candidate = argv[++i];
+    }
+    else if (strcmp(argv[i], "-rep") == 0 || strcmp(argv[i], "--replicates") == 0)
+    {
+      settings.replicates = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-g") == 0 || strcmp(argv[i], "--generations") == 0)
+    {
+      settings.generations = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-popsize") == 0 || strcmp(argv[i], "--population-size") == 0)
+    {
+      settings.population_size = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-nbdim") == 0 || strcmp(argv[i], "--number-of-dimensions") == 0)
+    {
+      settings.number_of_dimensions = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-noise") == 0 || strcmp(argv[i], "--noise") == 0)
+    {
+      i++;
+      if (strcmp(argv[i], "NONE") == 0)
+      {
+        settings.noise_type = NONE;
+      }
+      else if (strcmp(argv[i], "ISOTROPIC") == 0)
+      {
+        settings.noise_type = ISOTROPIC;
+      }
+      else if (strcmp(argv[i], "UNCORRELATED") == 0)
+      {
+        settings.noise_type = UNCORRELATED;
+      }
+      else if (strcmp(argv[i], "FULL") == 0)
+      {
+        settings.noise_type = FULL;
+      }
+      else
+      {
+        printf("Error: unknown type of noise %s. Exit.\n", argv[i]);
+        exit(EXIT_FAILURE);
+      }
+    }
+    else if (strcmp(argv[i], "-shutoffd") == 0 || strcmp(argv[i], "--shutoff-distance") == 0)
+    {
+      settings.shutoff_distance = atof(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-significance") == 0 || strcmp(argv[i], "--significance") == 0)
+    {
+      settings.significance = atof(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-output") == 0 || strcmp(argv[i], "--output") == 0)
+    {
+      settings.output = argv[++i];
+    }
+    else
+    {
+      printf("Error: unknown option %s (see -h or --help). Exit.\n", argv[i]);
+      exit(EXIT_FAILURE);
+    }
+  }
+  if (settings.replicates < 2 || settings.generations <= 0 || settings.population_size <= 0 || settings.number_of_dimensions <= 0)
+  {
+    printf("Error: at least two replicates are needed, and the numbers of generations, individuals and dimensions must be positive. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  if (settings.significance <= 0.0 || settings.significance >= 1.0)
+  {
+    printf("Error: the significance level must be in ]0, 1[. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+  checkEngine(settings.reference);
+  checkEngine(settings.candidate);
+}
+
+/**
+ * \brief    Print usage
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printUsage( void )
+{
+  std::cout << "Usage: test_equivalence -h or --help\n";
+  std::cout << "   or: test_equivalence [options]\n";
+  std::cout << "Runs replicates of the reference and candidate engines on disjoint seeds, compares the distributions of the mean\n";
+  std::cout << "dmu and Wz at each generation, and of the time to shutoff, with Kolmogorov-Smirnov, mean and variance tests, and\n";
+  std::cout << "fails if one of them is significant (Bonferroni correction)\n";
+  std::cout << "Options are:\n";
+  std::cout << "  -h, --help\n";
+  std::cout << "        print this help, then exit\n";
+  std::cout << "  -reference, --reference\n";
+  std::cout << "        specify the reference engine (REFERENCE by default)\n";
+  std::cout << "  -candidate, --candidate\n";
+  std::cout << "        specify the candidate engine (REFERENCE by default)\n";
+  std::cout << "  -rep, --replicates\n";
+  std::cout << "        specify the number of replicates per engine (50 by default)\n";
+  std::cout << "  -g, --generations\n";
+  std::cout << "        specify the number of generations per replicate (100 by default)\n";
+  std::cout << "  -popsize, --population-size\n";
+  std::cout << "        specify the population size (100 by default)\n";
+  std::cout << "  -nbdim, --number-of-dimensions\n";
+  std::cout << "        specify the number of phenotypic dimensions (3 by default)\n";
+  std::cout << "  -noise, --noise\n";
+  std::cout << "        specify the type of phenotypic noise (NONE, ISOTROPIC, UNCORRELATED, FULL; FULL by default)\n";
+  std::cout << "  -shutoffd, --shutoff-distance\n";
+  std::cout << "        specify the shutoff distance (1.5 by default); replicates not reaching it count as the last generation\n";
+  std::cout << "  -significance, --significance\n";
+  std::cout << "        specify the family-wise significance level (0.001 by default)\n";
+  std::cout << "  -output, --output\n";
+  std::cout << "        specify a file reporting every test\n";
+  std::cout << "Available engines are the values of -engine: REFERENCE (whole population reproduction), TILED (cache-sized tiles)\n";
+}
+
+/**
+ * \brief    Check that an engine exists
+ * \details  Engine names are read as the values of -engine (see Parameters::read_engine())
+ * \param    const std::string& engine
+ * \return   \e void
+ */
+void checkEngine( const std::string& engine )
+{
+  type_of_engine type = REFERENCE;
+  if (Parameters::read_engine(engine, type))
+  {
+    return;
+  }
+  printf("Error: unknown engine %s (see -h or --help). Exit.\n", engine.c_str());
+  exit(EXIT_FAILURE);
+}
+
+/**
+ * \brief    Run the replicates of an engine
+ * \details  Replicate r uses the seed first_seed+r. The time to shutoff is the first generation where the mean dmu reaches
+ *           the shutoff distance (as in Simulation::run_with_shutoff)
+ * \param    const test_settings& settings
+ * \param    const std::string& engine
+ * \param    unsigned long int first_seed
+ * \return   \e engine_sample
+ */
+engine_sample runEngine( const test_settings& settings, const std::string& engine, unsigned long int first_seed )
+{
+  engine_sample sample;
+  sample.dmu.assign(settings.generations, std::vector<double>(settings.replicates, 0.0));
+  sample.Wz.assign(settings.generations, std::vector<double>(settings.replicates, 0.0));
+  sample.time_to_shutoff.assign(settings.replicates, (double)settings.generations);
+  type_of_engine type = REFERENCE;
+  Parameters::read_engine(engine, type);
+  std::cout << "Running " << settings.replicates << " replicates of engine " << engine << " (seeds " << first_seed << " to " << first_seed+settings.replicates-1 << ")\n";
+  for (int r = 0; r < settings.replicates; r++)
+  {
+    Parameters* parameters = createTestParameters(first_seed+r, settings.generations, settings.number_of_dimensions, settings.population_size, settings.noise_type);
+    parameters->set_engine(type);
+    Simulation* simulation = new Simulation(parameters);
+    bool        shutoff    = false;
+    for (int g = 1; g <= settings.generations; g++)
+    {
+      simulation->run(g);
+      sample.dmu[g-1][r] = simulation->get_statistics()->get_dmu_mean();
+      sample.Wz[g-1][r]  = simulation->get_statistics()->get_Wz_mean();
+      if (!shutoff && fabs(sample.dmu[g-1][r]) <= fabs(settings.shutoff_distance))
+      {
+        sample.time_to_shutoff[r] = (double)g;
+        shutoff                   = true;
+      }
+    }
+    delete simulation;
+    simulation = NULL;
+    delete parameters;
+    parameters = NULL;
+  }
+  return sample;
+}
+
+/**
+ * \brief    Two-sample Kolmogorov-Smirnov test
+ * \details  Asymptotic p-value of the Kolmogorov distribution, with the small-sample correction of Stephens. Ties make the
+ *           test conservative
+ * \param    std::vector<double> x
+ * \param    std::vector<double> y
+ * \param    double& D
+ * \return   \e double
+ */
+double ksTest( std::vector<double> x, std::vector<double> y, double& D )
+{
+  std::sort(x.begin(), x.end());
+  std::sort(y.begin(), y.end());
+  size_t i = 0;
+  size_t j = 0;
+  D        = 0.0;
+  while (i < x.size() && j < y.size())
+  {
+    double value = std::min(x[i], y[j]);
+    while (i < x.size() && x[i] <= value)
+    {
+      i++;
+    }
+    while (j < y.size() && y[j] <= value)
+    {
+      j++;
+    }
+    D = std::max(D, fabs((double)i/x.size()-(double)j/y.size()));
+  }
+  double n      = (double)(x.size()*y.size())/(x.size()+y.size());
+  double lambda = (sqrt(n)+0.12+0.11/sqrt(n))*D;
+  if (lambda < 0.2)
+  {
+    return 1.0;
+  }
+  double p_value = 0.0;
+  for (int k = 1; k <= 100; k++)
+  {
+    double term  = 2.0*(k%2 == 1 ? 1.0 : -1.0)*exp(-2.0*k*k*lambda*lambda);
+    p_value     += term;
+    if (fabs(term) < 1e-12)
+    {
+      break;
+    }
+  }
+  return std::min(std::max(p_value, 0.0), 1.0);
+}
+
+/**
+ * \brief    Two-sample test of the means
+ * \details  Welch statistic, with its normal approximation (replicates are numerous)
+ * \param    const std::vector<double>& x
+ * \param    const std::vector<double>& y
+ * \return   \e double
+ */
+double meanTest( const std::vector<double>& x, const std::vector<double>& y )
+{
+  double mean_x = 0.0;
+  double mean_y = 0.0;
+  double var_x  = 0.0;
+  double var_y  = 0.0;
+  for (size_t i = 0; i < x.size(); i++)
+  {
+    mean_x += x[i]/x.size();
+  }
+  for (size_t i = 0; i < y.size(); i++)
+  {
+    mean_y += y[i]/y.size();
+  }
+  for (size_t i = 0; i < x.size(); i++)
+  {
+    var_x += (x[i]-mean_x)*(x[i]-mean_x)/(x.size()-1);
+  }
+  for (size_t i = 0; i < y.size(); i++)
+  {
+    var_y += (y[i]-mean_y)*(y[i]-mean_y)/(y.size()-1);
+  }
+  double se = sqrt(var_x/x.size()+var_y/y.size());
+  if (se == 0.0)
+  {
+    return (mean_x == mean_y ? 1.0 : 0.0);
+  }
+  return erfc(fabs(mean_x-mean_y)/se/sqrt(2.0));
+}
+
+/**
+ * \brief    Two-sample test of the variances
+ * \details  Compares the log-variances, with their normal approximation (replicates are numerous)
+ * \param    const std::vector<double>& x
+ * \param    const std::vector<double>& y
+ * \return   \e double
+ */
+double varianceTest( const std::vector<double>& x, const std::vector<double>& y )
+{
+  double mean_x = 0.0;
+  double mean_y = 0.0;
+  double var_x  = 0.0;
+  double var_y  = 0.0;
+  for (size_t i = 0; i < x.size(); i++)
+  {
+    mean_x += x[i]/x.size();
+  }
+  for (size_t i = 0; i < y.size(); i++)
+  {
+    mean_y += y[i]/y.size();
+  }
+  for (size_t i = 0; i < x.size(); i++)
+  {
+    var_x += (x[i]-mean_x)*(x[i]-mean_x)/(x.size()-1);
+  }
+  for (size_t i = 0; i < y.size(); i++)
+  {
+    var_y += (y[i]-mean_y)*(y[i]-mean_y)/(y.size()-1);
+  }
+  if (var_x == 0.0 || var_y == 0.0)
+  {
+    return (var_x == var_y ? 1.0 : 0.0);
+  }
+  double se = sqrt(2.0/(x.size()-1)+2.0/(y.size()-1));
+  return erfc(fabs(log(var_x)-log(var_y))/se/sqrt(2.0));
+}
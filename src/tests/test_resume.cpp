@@ -0,0 +1,339 @@
+/**
+ * \file      test_resume.cpp
+ * \authors   Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * \date      19-10-2026
+ * \copyright Copyright (C) 2016-2020 Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard. All rights reserved
+ * \license   This project is released under the GNU General Public License
+ * \brief     Invalid checkpoints are refused without affecting a concurrent simulation
+ */
+
+/***********************************************************************
+ * Copyright (C) 2016-2020
+ * Charles Rocabert, Guillaume Beslon, Carole Knibbe, Samuel Bernard
+ * Web: https://github.com/charlesrocabert/SigmaFGM/
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ***********************************************************************/
+
+#include "../../cmake/Config.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+#include <assert.h>
+
+#include "../lib/Macros.h"
+#include "../lib/Enums.h"
+#include "../lib/Parameters.h"
+#include "../lib/Simulation.h"
+#include "TestParameters.h"
+
+void        readArgs( int argc, char const** argv, unsigned long int& seed, int& population_size, int& dimensions, int& generations, std::string& output_path );
+void        printUsage( void );
+Parameters* createResumeParameters( unsigned long int seed, int generations, int dimensions, int population_size, std::string output_path );
+void        runSimulation( Parameters* parameters, bool* success );
+bool        checkRefused( Parameters* parameters, std::string name );
+std::string readFile( std::string filename );
+
+
+/**
+ * \brief    Main function
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \return   \e int
+ */
+int main( int argc, char const** argv )
+{
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 1) Read parameters                 */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  unsigned long int seed            = 1;
+  int               population_size = 100;
+  int               dimensions      = 3;
+  int               generations     = 50;
+  std::string       output_path     = "test_resume";
+  readArgs(argc, argv, seed, population_size, dimensions, generations, output_path);
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 2) Save a checkpoint               */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::string checkpoint_path = output_path+"/checkpointed";
+  std::string backup_filename = checkpoint_path+"/"+CHECKPOINT_FILE;
+  bool        success         = false;
+  Parameters* parameters      = createResumeParameters(seed, generations, dimensions, population_size, checkpoint_path);
+  parameters->set_checkpoint_interval(generations);
+  runSimulation(parameters, &success);
+  delete parameters;
+  parameters = NULL;
+  if (!success)
+  {
+    return EXIT_FAILURE;
+  }
+  std::string backup = readFile(backup_filename);
+  std::ofstream truncated_file((output_path+"/truncated.bin").c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+  truncated_file.write(backup.c_str(), backup.size()/2);
+  truncated_file.close();
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 3) Run a reference simulation      */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  parameters = createResumeParameters(seed+1, generations, dimensions, population_size, output_path+"/reference");
+  runSimulation(parameters, &success);
+  delete parameters;
+  parameters = NULL;
+  if (!success)
+  {
+    return EXIT_FAILURE;
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 4) Refuse invalid checkpoints      */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* The concurrent simulation runs with the seed of the reference one */
+  bool        concurrent_success    = false;
+  Parameters* concurrent_parameters = createResumeParameters(seed+1, generations, dimensions, population_size, output_path+"/concurrent");
+  std::thread concurrent(runSimulation, concurrent_parameters, &concurrent_success);
+  
+  /*----------------------------------------------- DIFFERENT PARAMETERS */
+  
+  parameters = createResumeParameters(seed, 2*generations, dimensions+1, population_size, checkpoint_path);
+  parameters->set_resume_filename(backup_filename);
+  success = checkRefused(parameters, "different number of dimensions");
+  delete parameters;
+  
+  /*----------------------------------------------- TRUNCATED CHECKPOINT */
+  
+  parameters = createResumeParameters(seed, 2*generations, dimensions, population_size, checkpoint_path);
+  parameters->set_resume_filename(output_path+"/truncated.bin");
+  success = checkRefused(parameters, "truncated checkpoint") && success;
+  delete parameters;
+  
+  /*----------------------------------------------- MISSING OUTPUT FILES */
+  
+  parameters = createResumeParameters(seed, 2*generations, dimensions, population_size, output_path+"/moved");
+  parameters->set_resume_filename(backup_filename);
+  success = checkRefused(parameters, "missing output files") && success;
+  delete parameters;
+  
+  /*----------------------------------------------- MISSING CHECKPOINT */
+  
+  parameters = createResumeParameters(seed, 2*generations, dimensions, population_size, checkpoint_path);
+  parameters->set_resume_filename(output_path+"/missing.bin");
+  success = checkRefused(parameters, "missing checkpoint") && success;
+  delete parameters;
+  parameters = NULL;
+  concurrent.join();
+  delete concurrent_parameters;
+  concurrent_parameters = NULL;
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 5) Compare with the reference      */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  std::string reference_mean = readFile(output_path+"/reference/mean.txt");
+  if (!concurrent_success || reference_mean == "" || readFile(output_path+"/concurrent/mean.txt") != reference_mean)
+  {
+    printf("Error: the concurrent simulation differs from the reference one.\n");
+    success = false;
+  }
+  
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  /* 6) Resume the valid checkpoint     */
+  /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+  bool resume_success = false;
+  parameters = createResumeParameters(seed, 2*generations, dimensions, population_size, checkpoint_path);
+  parameters->set_resume_filename(backup_filename);
+  runSimulation(parameters, &resume_success);
+  delete parameters;
+  parameters = NULL;
+  if (!resume_success)
+  {
+    printf("Error: the valid checkpoint was not resumed.\n");
+    success = false;
+  }
+  if (!success)
+  {
+    return EXIT_FAILURE;
+  }
+  std::cout << "Invalid checkpoints are refused, and the concurrent simulation is identical to the reference one.\n";
+  return EXIT_SUCCESS;
+}
+
+/**
+ * \brief    Read command line arguments
+ * \details  --
+ * \param    int argc
+ * \param    char const** argv
+ * \param    unsigned long int& seed
+ * \param    int& population_size
+ * \param    int& dimensions
+ * \param    int& generations
+ * \param    std::string& output_path
+ * \return   \e void
+ */
+void readArgs( int argc, char const** argv, unsigned long int& seed, int& population_size, int& dimensions, int& generations, std::string& output_path )
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+    {
+      printUsage();
+      exit(EXIT_SUCCESS);
+    }
+    else if (i+1 == argc)
+    {
+      std::cout << "Error: command line parameter value is missing.\n";
+      exit(EXIT_FAILURE);
+    }
+    else if (strcmp(argv[i], "-seed") == 0 || strcmp(argv[i], "--seed") == 0)
+    {
+      seed = (unsigned long int)atol(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-popsize") == 0 || strcmp(argv[i], "--population-size") == 0)
+    {
+      population_size = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-nbdim") == 0 || strcmp(argv[i], "--number-of-dimensions") == 0)
+    {
+      dimensions = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-g") == 0 || strcmp(argv[i], "--generations") == 0)
+    {
+      generations = atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-output") == 0 || strcmp(argv[i], "--output") == 0)
+    {
+      output_path = argv[++i];
+    }
+    else
+    {
+      printf("Error: unknown option %s (see -h or --help). Exit.\n", argv[i]);
+      exit(EXIT_FAILURE);
+    }
+  }
+  if (seed == 0 || population_size <= 0 || dimensions <= 0 || generations <= 0)
+  {
+    printf("Error: the seed, the population size, the number of dimensions and the number of generations must be positive. Exit.\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * \brief    Print usage
+ * \details  --
+ * \param    void
+ * \return   \e void
+ */
+void printUsage( void )
+{
+  std::cout << "Usage: test_resume -h or --help\n";
+  std::cout << "   or: test_resume [options]\n";
+  std::cout << "Saves a checkpoint, then tries to resume it with different parameters, truncated or missing, and without\n";
+  std::cout << "its output files, while another simulation runs. Fails if one of them is accepted, if the concurrent simulation\n";
+  std::cout << "differs from the same simulation run alone, or if the valid checkpoint cannot be resumed\n";
+  std::cout << "Options are:\n";
+  std::cout << "  -h, --help\n";
+  std::cout << "        print this help, then exit\n";
+  std::cout << "  -seed, --seed (default: 1)\n";
+  std::cout << "        Seed of the checkpointed simulation (the concurrent one uses the next seed)\n";
+  std::cout << "  -popsize, --population-size (default: 100)\n";
+  std::cout << "        Population size\n";
+  std::cout << "  -nbdim, --number-of-dimensions (default: 3)\n";
+  std::cout << "        Number of dimensions\n";
+  std::cout << "  -g, --generations (default: 50)\n";
+  std::cout << "        Number of generations before the checkpoint\n";
+  std::cout << "  -output, --output (default: test_resume)\n";
+  std::cout << "        Folder of the simulation outputs\n";
+  std::cout << "\n";
+}
+
+/**
+ * \brief    Create the parameters of a simulation writing its outputs
+ * \details  --
+ * \param    unsigned long int seed
+ * \param    int generations
+ * \param    int dimensions
+ * \param    int population_size
+ * \param    std::string output_path
+ * \return   \e Parameters*
+ */
+Parameters* createResumeParameters( unsigned long int seed, int generations, int dimensions, int population_size, std::string output_path )
+{
+  Parameters* parameters = createTestParameters(seed, generations, dimensions, population_size, FULL);
+  parameters->set_output_path(output_path);
+  parameters->set_file_output(true);
+  return parameters;
+}
+
+/**
+ * \brief    Create and run a simulation
+ * \details  success is set to false if the simulation cannot be created
+ * \param    Parameters* parameters
+ * \param    bool* success
+ * \return   \e void
+ */
+void runSimulation( Parameters* parameters, bool* success )
+{
+  std::string error;
+  Simulation* simulation = Simulation::create(parameters, error);
+  *success = (simulation != NULL);
+  if (simulation == NULL)
+  {
+    printf("Error: %s.\n", error.c_str());
+    return;
+  }
+  simulation->execute();
+  delete simulation;
+  simulation = NULL;
+}
+
+/**
+ * \brief    Check that a simulation cannot be created
+ * \details  --
+ * \param    Parameters* parameters
+ * \param    std::string name
+ * \return   \e bool
+ */
+bool checkRefused( Parameters* parameters, std::string name )
+{
+  std::string error;
+  Simulation* simulation = Simulation::create(parameters, error);
+  if (simulation != NULL)
+  {
+    printf("Error: the checkpoint was resumed despite a %s.\n", name.c_str());
+    delete simulation;
+    simulation = NULL;
+    return false;
+  }
+  std::cout << name << " refused: " << error << "\n";
+  return true;
+}
+
+/**
+ * \brief    Read a whole file
+ * \details  Returns an empty string if the file cannot be opened
+ * \param    std::string filename
+ * \return   \e std::string
+ */
+std::string readFile( std::string filename )
+{
+  std::ifstream     file(filename.c_str(), std::ios::in | std::ios::binary);
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}